@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "breezedbussubscriptionhub.h"
+#include "breezedecoration.h"
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusReply>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QTest>
+
+#include <array>
+
+namespace Breeze
+{
+
+// decorations are never dereferenced by the hub unless a signal is received, which does not happen on the private bus
+void Decoration::reloadSharedConfiguration()
+{
+}
+
+void Decoration::reconfigureMain(const bool, const bool)
+{
+}
+
+void Decoration::onTabletModeChanged(bool)
+{
+}
+
+}
+
+using namespace Breeze;
+
+class DBusSubscriptionHubTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void testSingleSubscription();
+
+private:
+    //* number of match rules registered by this process on the bus, or -1 if unavailable
+    int matchRules() const;
+
+    QProcess _daemon;
+};
+
+//* number of decorations registered to the hub
+static constexpr int decorationCount = 16;
+
+//____________________________________________________________________
+void DBusSubscriptionHubTest::initTestCase()
+{
+    const QString daemon = QStandardPaths::findExecutable(QStringLiteral("dbus-daemon"));
+    if (daemon.isEmpty()) {
+        QSKIP("dbus-daemon not found");
+    }
+
+    // a private bus, so that match rules of other clients, and signals from the running session, do not interfere
+    _daemon.start(daemon, {QStringLiteral("--session"), QStringLiteral("--nofork"), QStringLiteral("--print-address")});
+    QVERIFY(_daemon.waitForStarted());
+    while (!_daemon.canReadLine()) {
+        QVERIFY(_daemon.waitForReadyRead());
+    }
+
+    const QByteArray address = _daemon.readLine().trimmed();
+    QVERIFY(!address.isEmpty());
+
+    // read by the session bus connection when it is first used
+    qputenv("DBUS_SESSION_BUS_ADDRESS", address);
+    QVERIFY(QDBusConnection::sessionBus().isConnected());
+}
+
+//____________________________________________________________________
+void DBusSubscriptionHubTest::cleanupTestCase()
+{
+    if (_daemon.state() != QProcess::NotRunning) {
+        _daemon.terminate();
+        _daemon.waitForFinished();
+    }
+}
+
+//____________________________________________________________________
+int DBusSubscriptionHubTest::matchRules() const
+{
+    auto message = QDBusMessage::createMethodCall(QStringLiteral("org.freedesktop.DBus"),
+                                                  QStringLiteral("/org/freedesktop/DBus"),
+                                                  QStringLiteral("org.freedesktop.DBus.Debug.Stats"),
+                                                  QStringLiteral("GetConnectionStats"));
+    message.setArguments({QDBusConnection::sessionBus().baseService()});
+
+    const QDBusReply<QVariantMap> reply = QDBusConnection::sessionBus().call(message);
+    if (!reply.isValid() || !reply.value().contains(QStringLiteral("MatchRules"))) {
+        return -1;
+    }
+
+    return reply.value().value(QStringLiteral("MatchRules")).toInt();
+}
+
+//____________________________________________________________________
+void DBusSubscriptionHubTest::testSingleSubscription()
+{
+    const int baseline = matchRules();
+    if (baseline < 0) {
+        QSKIP("dbus-daemon was built without the org.freedesktop.DBus.Debug.Stats interface");
+    }
+
+    // only used as keys by the hub
+    std::array<char, decorationCount> storage;
+    auto decoration = [&storage](int index) {
+        return reinterpret_cast<Decoration *>(&storage[index]);
+    };
+
+    DBusSubscriptionHub *hub = DBusSubscriptionHub::acquire(decoration(0));
+    QVERIFY(hub);
+    const int subscribed = matchRules();
+    QVERIFY(subscribed > baseline);
+
+    // one rule per signal, and the owner watch of the KWin service
+    QVERIFY(subscribed - baseline <= 3);
+
+    // further decorations share the hub and its subscriptions
+    for (int i = 1; i < decorationCount; ++i) {
+        QCOMPARE(DBusSubscriptionHub::acquire(decoration(i)), hub);
+    }
+    QCOMPARE(DBusSubscriptionHub::decorationCount(), decorationCount);
+    QCOMPARE(matchRules(), subscribed);
+
+    // registering a decoration twice is harmless
+    DBusSubscriptionHub::acquire(decoration(0));
+    QCOMPARE(DBusSubscriptionHub::decorationCount(), decorationCount);
+    QCOMPARE(matchRules(), subscribed);
+
+    // subscriptions are dropped along with the last decoration
+    for (int i = 0; i < decorationCount - 1; ++i) {
+        DBusSubscriptionHub::release(decoration(i));
+    }
+    QCOMPARE(DBusSubscriptionHub::decorationCount(), 1);
+    QCOMPARE(matchRules(), subscribed);
+
+    DBusSubscriptionHub::release(decoration(decorationCount - 1));
+    QCOMPARE(DBusSubscriptionHub::decorationCount(), 0);
+    QTRY_COMPARE(matchRules(), baseline);
+}
+
+QTEST_GUILESS_MAIN(DBusSubscriptionHubTest)
+
+#include "dbussubscriptionhubtest.moc"
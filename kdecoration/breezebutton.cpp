@@ -11,6 +11,7 @@
 #include "geometrytools.h"
 #include "renderdecorationbuttonicon.h"
 #include "systemicontheme.h"
+#include "tracing.h"
 
 #include <KColorScheme>
 #include <KColorUtils>
@@ -139,6 +140,8 @@ void Button::paint(QPainter *painter, const QRectF &repaintRegion)
     if (!geometry().intersects(repaintRegion)) {
         return;
     }
+
+    HELIUM_TRACE_SCOPE("decoration", "Button::paint");
     if (!m_d) {
         return;
     }
@@ -327,6 +330,12 @@ QColor Button::foregroundColor(const bool getNonAnimatedColor) const
             return foregroundPressActiveStateAnimated(active, getNonAnimatedColor);
         }
     } else if (m_animation->state() == QAbstractAnimation::Running && !getNonAnimatedColor) { // button hover animation
+        if (m_d->activeStateChangeAnimation()->state() != QAbstractAnimation::Running) {
+            const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
+            return group->foregroundHoverRamp.at(m_opacity);
+        }
+
+        // both animations running: mix the animated normal and hover colours
         QColor foregroundNormal = foregroundNormalActiveStateAnimated(active, getNonAnimatedColor);
         QColor foregroundHover = foregroundHoverActiveStateAnimated(active, getNonAnimatedColor);
         if (foregroundNormal.isValid() && foregroundHover.isValid()) {
@@ -345,17 +354,7 @@ QColor Button::foregroundColor(const bool getNonAnimatedColor) const
 QColor Button::foregroundNormalActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->foregroundNormal.isValid() && m_buttonPalette->inactive()->foregroundNormal.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->foregroundNormal,
-                                    m_buttonPalette->active()->foregroundNormal,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->foregroundNormal.isValid() && !m_buttonPalette->inactive()->foregroundNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->foregroundNormal, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->foregroundNormal.isValid() && m_buttonPalette->inactive()->foregroundNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->foregroundNormal, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::IconNormal).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->foregroundNormal;
@@ -365,17 +364,7 @@ QColor Button::foregroundNormalActiveStateAnimated(const bool active, const bool
 QColor Button::foregroundHoverActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->foregroundHover.isValid() && m_buttonPalette->inactive()->foregroundHover.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->foregroundHover,
-                                    m_buttonPalette->active()->foregroundHover,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->foregroundHover.isValid() && !m_buttonPalette->inactive()->foregroundHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->foregroundHover, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->foregroundHover.isValid() && m_buttonPalette->inactive()->foregroundHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->foregroundHover, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::IconHover).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->foregroundHover;
@@ -385,16 +374,7 @@ QColor Button::foregroundHoverActiveStateAnimated(const bool active, const bool
 QColor Button::foregroundPressActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->foregroundPress.isValid() && m_buttonPalette->inactive()->foregroundPress.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->foregroundPress,
-                                    m_buttonPalette->active()->foregroundPress,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->foregroundPress.isValid() && !m_buttonPalette->inactive()->foregroundPress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->foregroundPress, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->foregroundPress.isValid() && m_buttonPalette->inactive()->foregroundPress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->foregroundPress, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else
-            return QColor();
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::IconPress).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->foregroundPress;
@@ -424,6 +404,12 @@ QColor Button::backgroundColor(const bool getNonAnimatedColor) const
             return backgroundPressActiveStateAnimated(active, getNonAnimatedColor);
         }
     } else if (m_animation->state() == QAbstractAnimation::Running && !getNonAnimatedColor) { // button hover animation
+        if (m_d->activeStateChangeAnimation()->state() != QAbstractAnimation::Running) {
+            const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
+            return group->backgroundHoverRamp.at(m_opacity);
+        }
+
+        // both animations running: mix the animated normal and hover colours
         QColor backgroundNormal = backgroundNormalActiveStateAnimated(active, getNonAnimatedColor);
         QColor backgroundHover = backgroundHoverActiveStateAnimated(active, getNonAnimatedColor);
         if (backgroundNormal.isValid() && backgroundHover.isValid()) {
@@ -442,17 +428,7 @@ QColor Button::backgroundColor(const bool getNonAnimatedColor) const
 QColor Button::backgroundNormalActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->backgroundNormal.isValid() && m_buttonPalette->inactive()->backgroundNormal.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->backgroundNormal,
-                                    m_buttonPalette->active()->backgroundNormal,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->backgroundNormal.isValid() && !m_buttonPalette->inactive()->backgroundNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->backgroundNormal, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->backgroundNormal.isValid() && m_buttonPalette->inactive()->backgroundNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->backgroundNormal, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::BackgroundNormal).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->backgroundNormal;
@@ -462,17 +438,7 @@ QColor Button::backgroundNormalActiveStateAnimated(const bool active, const bool
 QColor Button::backgroundHoverActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->backgroundHover.isValid() && m_buttonPalette->inactive()->backgroundHover.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->backgroundHover,
-                                    m_buttonPalette->active()->backgroundHover,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->backgroundHover.isValid() && !m_buttonPalette->inactive()->backgroundHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->backgroundHover, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->backgroundHover.isValid() && m_buttonPalette->inactive()->backgroundHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->backgroundHover, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::BackgroundHover).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->backgroundHover;
@@ -482,16 +448,7 @@ QColor Button::backgroundHoverActiveStateAnimated(const bool active, const bool
 QColor Button::backgroundPressActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->backgroundPress.isValid() && m_buttonPalette->inactive()->backgroundPress.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->backgroundPress,
-                                    m_buttonPalette->active()->backgroundPress,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->backgroundPress.isValid() && !m_buttonPalette->inactive()->backgroundPress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->backgroundPress, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->backgroundPress.isValid() && m_buttonPalette->inactive()->backgroundPress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->backgroundPress, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else
-            return QColor();
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::BackgroundPress).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->backgroundPress;
@@ -520,6 +477,12 @@ QColor Button::outlineColor(const bool getNonAnimatedColor) const
             return outlinePressActiveStateAnimated(active, getNonAnimatedColor);
         }
     } else if (m_animation->state() == QAbstractAnimation::Running && !getNonAnimatedColor) { // button hover animation
+        if (m_d->activeStateChangeAnimation()->state() != QAbstractAnimation::Running) {
+            const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
+            return group->outlineHoverRamp.at(m_opacity);
+        }
+
+        // both animations running: mix the animated normal and hover colours
         QColor outlineHover = outlineHoverActiveStateAnimated(active, getNonAnimatedColor);
         QColor outlineNormal = outlineNormalActiveStateAnimated(active, getNonAnimatedColor);
         if (outlineNormal.isValid() && outlineHover.isValid()) {
@@ -538,17 +501,7 @@ QColor Button::outlineColor(const bool getNonAnimatedColor) const
 QColor Button::outlineNormalActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->outlineNormal.isValid() && m_buttonPalette->inactive()->outlineNormal.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->outlineNormal,
-                                    m_buttonPalette->active()->outlineNormal,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->outlineNormal.isValid() && !m_buttonPalette->inactive()->outlineNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->outlineNormal, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->outlineNormal.isValid() && m_buttonPalette->inactive()->outlineNormal.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->outlineNormal, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::OutlineNormal).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->outlineNormal;
@@ -558,17 +511,7 @@ QColor Button::outlineNormalActiveStateAnimated(const bool active, const bool ge
 QColor Button::outlineHoverActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->outlineHover.isValid() && m_buttonPalette->inactive()->outlineHover.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->outlineHover,
-                                    m_buttonPalette->active()->outlineHover,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->outlineHover.isValid() && !m_buttonPalette->inactive()->outlineHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->outlineHover, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->outlineHover.isValid() && m_buttonPalette->inactive()->outlineHover.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->outlineHover, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else {
-            return QColor();
-        }
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::OutlineHover).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->outlineHover;
@@ -578,16 +521,7 @@ QColor Button::outlineHoverActiveStateAnimated(const bool active, const bool get
 QColor Button::outlinePressActiveStateAnimated(const bool active, const bool getNonAnimatedColor) const
 {
     if (!getNonAnimatedColor && m_d->activeStateChangeAnimation()->state() == QAbstractAnimation::Running) {
-        if (m_buttonPalette->active()->outlinePress.isValid() && m_buttonPalette->inactive()->outlinePress.isValid()) {
-            return KColorUtils::mix(m_buttonPalette->inactive()->outlinePress,
-                                    m_buttonPalette->active()->outlinePress,
-                                    m_d->activeStateChangeAnimationOpacity());
-        } else if (m_buttonPalette->active()->outlinePress.isValid() && !m_buttonPalette->inactive()->outlinePress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->active()->outlinePress, m_d->activeStateChangeAnimationOpacity());
-        } else if (!m_buttonPalette->active()->outlinePress.isValid() && m_buttonPalette->inactive()->outlinePress.isValid()) {
-            return ColorTools::alphaMix(m_buttonPalette->inactive()->outlinePress, (1.0 - m_d->activeStateChangeAnimationOpacity()));
-        } else
-            return QColor();
+        return m_buttonPalette->activeStateRamp(OverridableButtonColorState::OutlinePress).at(m_d->activeStateChangeAnimationOpacity());
     } else {
         const DecorationButtonPaletteGroup *group = active ? m_buttonPalette->active() : m_buttonPalette->inactive();
         return group->outlinePress;
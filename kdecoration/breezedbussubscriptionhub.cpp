@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "breezedbussubscriptionhub.h"
+#include "breezedecoration.h"
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+
+namespace Breeze
+{
+
+DBusSubscriptionHub *DBusSubscriptionHub::s_self = nullptr;
+
+//__________________________________________________________________
+DBusSubscriptionHub::DBusSubscriptionHub()
+{
+    auto dbus = QDBusConnection::sessionBus();
+
+    // use DBus connection to update on Klassy configuration change
+    dbus.connect(QString(),
+                 QStringLiteral("/KGlobalSettings"),
+                 QStringLiteral("org.kde.KGlobalSettings"),
+                 QStringLiteral("notifyChange"),
+                 this,
+                 SLOT(onNotifyChange()));
+
+    // Implement tablet mode DBus connection
+    dbus.connect(QStringLiteral("org.kde.KWin"),
+                 QStringLiteral("/org/kde/KWin"),
+                 QStringLiteral("org.kde.KWin.TabletModeManager"),
+                 QStringLiteral("tabletModeChanged"),
+                 QStringLiteral("b"),
+                 this,
+                 SLOT(onTabletModeChanged(bool)));
+
+    auto message = QDBusMessage::createMethodCall(QStringLiteral("org.kde.KWin"),
+                                                  QStringLiteral("/org/kde/KWin"),
+                                                  QStringLiteral("org.freedesktop.DBus.Properties"),
+                                                  QStringLiteral("Get"));
+    message.setArguments({QStringLiteral("org.kde.KWin.TabletModeManager"), QStringLiteral("tabletMode")});
+    auto call = new QDBusPendingCallWatcher(dbus.asyncCall(message), this);
+    connect(call, &QDBusPendingCallWatcher::finished, this, [this, call]() {
+        QDBusPendingReply<QVariant> reply = *call;
+        if (!reply.isError()) {
+            onTabletModeChanged(reply.value().toBool());
+        }
+
+        call->deleteLater();
+    });
+}
+
+//__________________________________________________________________
+DBusSubscriptionHub::~DBusSubscriptionHub()
+{
+    // subscriptions are dropped by QDBusConnection when the receiver is destroyed
+    s_self = nullptr;
+}
+
+//__________________________________________________________________
+DBusSubscriptionHub *DBusSubscriptionHub::acquire(Decoration *decoration)
+{
+    if (!s_self) {
+        s_self = new DBusSubscriptionHub();
+    }
+
+    if (!s_self->m_decorations.contains(decoration)) {
+        s_self->m_decorations.append(decoration);
+    }
+
+    return s_self;
+}
+
+//__________________________________________________________________
+void DBusSubscriptionHub::release(Decoration *decoration)
+{
+    if (!s_self) {
+        return;
+    }
+
+    s_self->m_decorations.removeOne(decoration);
+    if (s_self->m_decorations.isEmpty()) {
+        delete s_self;
+    }
+}
+
+//__________________________________________________________________
+void DBusSubscriptionHub::onNotifyChange()
+{
+    // a single settings change is often notified several times in a row. Coalesce them into one pass
+    if (m_reconfigureQueued) {
+        return;
+    }
+
+    m_reconfigureQueued = true;
+    QMetaObject::invokeMethod(this, &DBusSubscriptionHub::reconfigureDecorations, Qt::QueuedConnection);
+}
+
+//__________________________________________________________________
+void DBusSubscriptionHub::onTabletModeChanged(bool mode)
+{
+    if (m_tabletMode == mode) {
+        return;
+    }
+
+    m_tabletMode = mode;
+
+    for (Decoration *decoration : std::as_const(m_decorations)) {
+        decoration->onTabletModeChanged(mode);
+    }
+}
+
+//__________________________________________________________________
+void DBusSubscriptionHub::reconfigureDecorations()
+{
+    m_reconfigureQueued = false;
+
+    // configuration shared by all decorations is reloaded once for the whole pass
+    Decoration::reloadSharedConfiguration();
+
+    for (Decoration *decoration : std::as_const(m_decorations)) {
+        decoration->reconfigureMain(false, false);
+    }
+}
+
+}
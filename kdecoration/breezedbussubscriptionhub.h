@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QObject>
+#include <QVector>
+
+namespace Breeze
+{
+
+class Decoration;
+
+/**
+ * @brief Process-wide owner of the D-Bus subscriptions decorations depend on.
+ *        Holds a single subscription per signal and a single cached tablet mode value, whatever the number of decorations,
+ *        and dispatches changes to all live decorations in one batched pass.
+ *        The hub is reference counted by the decorations registered to it: it is created by the first acquire(),
+ *        and destroyed, dropping its subscriptions, by the last release().
+ */
+class DBusSubscriptionHub : public QObject
+{
+    Q_OBJECT
+
+public:
+    //* register decoration, creating the hub and its subscriptions if needed
+    static DBusSubscriptionHub *acquire(Decoration *);
+
+    //* unregister decoration. Does nothing if the decoration is not registered
+    static void release(Decoration *);
+
+    //* number of registered decorations
+    static int decorationCount()
+    {
+        return s_self ? s_self->m_decorations.size() : 0;
+    }
+
+    //* cached tablet mode
+    bool tabletMode() const
+    {
+        return m_tabletMode;
+    }
+
+private Q_SLOTS:
+    //* KGlobalSettings changed
+    void onNotifyChange();
+
+    //* tablet mode changed
+    void onTabletModeChanged(bool);
+
+    //* reconfigure all decorations
+    void reconfigureDecorations();
+
+private:
+    //* constructor
+    DBusSubscriptionHub();
+
+    //* destructor
+    ~DBusSubscriptionHub() override;
+
+    //* registered decorations
+    QVector<Decoration *> m_decorations;
+
+    //* cached tablet mode
+    bool m_tabletMode = false;
+
+    //* whether a reconfiguration pass is queued
+    bool m_reconfigureQueued = false;
+
+    //* singleton
+    static DBusSubscriptionHub *s_self;
+};
+
+}
@@ -15,9 +15,12 @@
 
 #include "breezeboxshadowrenderer.h"
 #include "breezebutton.h"
+#include "breezedbussubscriptionhub.h"
 #include "breezesettingsprovider.h"
+#include "breezeshadowcache.h"
 #include "dbusupdatenotifier.h"
 #include "geometrytools.h"
+#include "tracing.h"
 
 #include <KDecoration3/DecorationButtonGroup>
 #include <KDecoration3/DecorationShadow>
@@ -28,10 +31,7 @@
 #include <KPluginFactory>
 #include <KWindowSystem>
 
-#include <QDBusConnection>
-#include <QDBusMessage>
-#include <QDBusPendingCallWatcher>
-#include <QDBusPendingReply>
+#include <QCache>
 #include <QPainter>
 #include <QTextStream>
 #include <QTimer>
@@ -123,6 +123,7 @@ namespace Breeze
 {
 
 KSharedConfig::Ptr Decoration::s_kdeGlobalConfig = KSharedConfig::Ptr();
+Decoration::GeometryUpdateStatistics Decoration::s_geometryUpdateStatistics;
 
 using KDecoration3::ColorGroup;
 using KDecoration3::ColorRole;
@@ -144,6 +145,81 @@ static qreal g_thinWindowOutlineThickness = 1;
 static std::shared_ptr<KDecoration3::DecorationShadow> g_sShadow;
 static std::shared_ptr<KDecoration3::DecorationShadow> g_sShadowInactive;
 
+//* blurred shadow textures shared by all decorations, so that redrawing the thin window outline never re-runs the blur. Cost is in kilobytes
+static QCache<ShadowBaseKey, ShadowBase> g_shadowBaseCache(8 * 1024);
+
+//________________________________________________________________
+static ShadowBase shadowBase(const QColor &shadowColor, int shadowSize, qreal cornerRadius, bool topCornersOnly, bool persistent)
+{
+    HELIUM_TRACE_SCOPE("decoration", "shadowBase");
+
+    const ShadowBaseKey key{shadowColor.rgba(), shadowSize, cornerRadius, topCornersOnly};
+    if (const ShadowBase *cached = g_shadowBaseCache.object(key)) {
+        return *cached;
+    }
+
+    // textures rendered by a previous KWin instance are mapped from disk
+    ShadowBase base;
+    if (persistent && ShadowDiskCache::load(key, base)) {
+        g_shadowBaseCache.insert(key, new ShadowBase(base), qMax<qsizetype>(1, base.image.sizeInBytes() / 1024));
+        return base;
+    }
+
+    const CompositeShadowParams params = lookupShadowParams(shadowSize);
+
+    const QSize boxSize =
+        BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius).expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
+
+    BoxShadowRenderer shadowRenderer;
+
+    shadowRenderer.setBorderRadius(cornerRadius + 0.5);
+    shadowRenderer.setBoxSize(boxSize);
+    shadowRenderer.addShadow(params.shadow1.offset, params.shadow1.radius, ColorTools::alphaMix(shadowColor, params.shadow1.opacity));
+    shadowRenderer.addShadow(params.shadow2.offset, params.shadow2.radius, ColorTools::alphaMix(shadowColor, params.shadow2.opacity));
+
+    base.image = shadowRenderer.render();
+
+    QPainter painter(&base.image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    const QRectF outerRect = base.image.rect();
+
+    QRectF boxRect(QPoint(0, 0), boxSize);
+    boxRect.moveCenter(outerRect.center());
+
+    // Mask out inner rect.
+    base.padding = QMarginsF(boxRect.left() - outerRect.left() - Metrics::Decoration_Shadow_Overlap - params.offset.x(),
+                             boxRect.top() - outerRect.top() - Metrics::Decoration_Shadow_Overlap - params.offset.y(),
+                             outerRect.right() - boxRect.right() - Metrics::Decoration_Shadow_Overlap + params.offset.x(),
+                             outerRect.bottom() - boxRect.bottom() - Metrics::Decoration_Shadow_Overlap + params.offset.y());
+    base.innerRect = outerRect - base.padding;
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::black);
+    painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+
+    QPainterPath roundedRectMask;
+    if (topCornersOnly) {
+        roundedRectMask = GeometryTools::roundedPath(base.innerRect, CornersTop, cornerRadius + 0.5);
+    } else {
+        roundedRectMask.addRoundedRect(base.innerRect, cornerRadius + 0.5, cornerRadius + 0.5);
+    }
+
+    painter.drawPath(roundedRectMask);
+    painter.end();
+
+    // colours mixed by the shadow animation are used for a single frame, and would only evict the stable textures
+    if (!persistent) {
+        return base;
+    }
+
+    ShadowDiskCache::store(key, base);
+
+    // the image is implicitly shared, so caching a copy is cheap. The cache may delete the entry straight away if it is too large
+    g_shadowBaseCache.insert(key, new ShadowBase(base), qMax<qsizetype>(1, base.image.sizeInBytes() / 1024));
+    return base;
+}
+
 //________________________________________________________________
 Decoration::Decoration(QObject *parent, const QVariantList &args)
     : KDecoration3::Decoration(parent, args)
@@ -164,10 +240,13 @@ Decoration::Decoration(QObject *parent, const QVariantList &args)
 //________________________________________________________________
 Decoration::~Decoration()
 {
+    DBusSubscriptionHub::release(this);
+
     g_sDecoCount--;
     if (g_sDecoCount == 0) {
         // last deco destroyed, clean up shadow
         g_sShadow.reset();
+        g_shadowBaseCache.clear();
     }
 }
 
@@ -188,12 +267,8 @@ QColor Decoration::titleBarColor(bool returnNonAnimatedColor) const
     if (hideTitleBar() && !m_internalSettings->useTitleBarColorForAllBorders())
         return c->color(ColorGroup::Inactive, ColorRole::TitleBar);
 
-    QColor activeTitleBarColor = m_decorationColors->active()->titleBarBase;
-    QColor inactiveTitlebarColor = m_decorationColors->inactive()->titleBarBase;
-    if (m_internalSettings->opaqueTitleBar() || (m_internalSettings->opaqueMaximizedTitleBars() && c->isMaximized())) {
-        activeTitleBarColor.setAlpha(255);
-        inactiveTitlebarColor.setAlpha(255);
-    }
+    QColor activeTitleBarColor = titleBarColorForState(true);
+    QColor inactiveTitlebarColor = titleBarColorForState(false);
 
     // do not animate titlebar if there is a tools area/header area as it causes glitches
     if (!m_toolsAreaWillBeDrawn && (m_animation->state() == QAbstractAnimation::Running) && !returnNonAnimatedColor) {
@@ -203,6 +278,18 @@ QColor Decoration::titleBarColor(bool returnNonAnimatedColor) const
     }
 }
 
+//________________________________________________________________
+QColor Decoration::titleBarColorForState(const bool active) const
+{
+    auto c = window();
+
+    QColor color = active ? m_decorationColors->active()->titleBarBase : m_decorationColors->inactive()->titleBarBase;
+    if (m_internalSettings->opaqueTitleBar() || (m_internalSettings->opaqueMaximizedTitleBars() && c->isMaximized())) {
+        color.setAlpha(255);
+    }
+    return color;
+}
+
 //________________________________________________________________
 QColor Decoration::titleBarSeparatorColor() const
 {
@@ -286,6 +373,9 @@ void Decoration::init()
 {
     auto c = window();
 
+    // D-Bus subscriptions are shared by all decorations
+    m_tabletMode = DBusSubscriptionHub::acquire(this)->tabletMode();
+
     reconfigureMain(true);
     
     // active state change animation
@@ -317,50 +407,24 @@ void Decoration::init()
             updateShadow(false, true, true);
     });
 
-    // use DBus connection to update on Klassy configuration change
-    auto dbus = QDBusConnection::sessionBus();
-
-    dbus.connect(QString(),
-                 QStringLiteral("/KGlobalSettings"),
-                 QStringLiteral("org.kde.KGlobalSettings"),
-                 QStringLiteral("notifyChange"),
-                 this,
-                 SLOT(reconfigure()));
-
-    // Implement tablet mode DBus connection
-    dbus.connect(QStringLiteral("org.kde.KWin"),
-                 QStringLiteral("/org/kde/KWin"),
-                 QStringLiteral("org.kde.KWin.TabletModeManager"),
-                 QStringLiteral("tabletModeChanged"),
-                 QStringLiteral("b"),
-                 this,
-                 SLOT(onTabletModeChanged(bool)));
-
-    auto message = QDBusMessage::createMethodCall(QStringLiteral("org.kde.KWin"),
-                                                  QStringLiteral("/org/kde/KWin"),
-                                                  QStringLiteral("org.freedesktop.DBus.Properties"),
-                                                  QStringLiteral("Get"));
-    message.setArguments({QStringLiteral("org.kde.KWin.TabletModeManager"), QStringLiteral("tabletMode")});
-    auto call = new QDBusPendingCallWatcher(dbus.asyncCall(message), this);
-    connect(call, &QDBusPendingCallWatcher::finished, this, [this, call]() {
-        QDBusPendingReply<QVariant> reply = *call;
-        if (!reply.isError()) {
-            onTabletModeChanged(reply.value().toBool());
-        }
-
-        call->deleteLater();
-    });
-
     updateTitleBar();
     auto s = settings();
-    connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, &Decoration::recalculateBorders);
-    connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, &Decoration::updateBlur); // for the case when a border with transparency
+    // borders are recalculated straight away, as KWin reads them back synchronously when computing the new frame geometry.
+    // Everything depending on them is coalesced into a single ordered pass per event loop turn
+    connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, [this]() {
+        recalculateBorders();
+        scheduleGeometryUpdate(GeometryUpdateBlur); // for the case when a border with transparency
+    });
 
     // a change in font might cause the borders to change
-    connect(s.get(), &KDecoration3::DecorationSettings::fontChanged, this, &Decoration::recalculateBorders);
-    connect(s.get(), &KDecoration3::DecorationSettings::fontChanged, this, &Decoration::updateBlur); // for the case when a border with transparency
-    connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, &Decoration::recalculateBorders);
-    connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, &Decoration::updateBlur); // for the case when a border with transparency
+    connect(s.get(), &KDecoration3::DecorationSettings::fontChanged, this, [this]() {
+        recalculateBorders();
+        scheduleGeometryUpdate(GeometryUpdateBlur); // for the case when a border with transparency
+    });
+    connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, [this]() {
+        recalculateBorders();
+        scheduleGeometryUpdate(GeometryUpdateBlur); // for the case when a border with transparency
+    });
 
     // color cache update
     // The slot will only update if the UUID has changed, hence preventing unnecessary multiple colour cache updates
@@ -382,31 +446,37 @@ void Decoration::init()
     connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, this, &Decoration::reconfigure);
     connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, this, &Decoration::updateButtonsGeometryDelayed);
 
-    connect(c, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::recalculateBorders);
+    connect(c, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, [this]() {
+        recalculateBorders();
+        scheduleGeometryUpdate(GeometryUpdateTitleBar | GeometryUpdateButtons);
+    });
     connect(c, &KDecoration3::DecoratedWindow::maximizedHorizontallyChanged, this, &Decoration::recalculateBorders);
     connect(c, &KDecoration3::DecoratedWindow::maximizedVerticallyChanged, this, &Decoration::recalculateBorders);
-    connect(c, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::recalculateBorders);
-    connect(c, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::updateShadowOnShadedChange);
+    connect(c, &KDecoration3::DecoratedWindow::shadedChanged, this, [this]() {
+        recalculateBorders();
+        scheduleGeometryUpdate(GeometryUpdateButtons | GeometryUpdateShadow);
+    });
     connect(c, &KDecoration3::DecoratedWindow::captionChanged, this, [this]() {
         // update the caption area
         update(titleBar());
     });
 
     connect(c, &KDecoration3::DecoratedWindow::activeChanged, this, &Decoration::updateAnimationState);
-    connect(c, &KDecoration3::DecoratedWindow::activeChanged, this, &Decoration::updateOpaque);
-    connect(c, &KDecoration3::DecoratedWindow::activeChanged, this, &Decoration::updateBlur);
-    connect(this, &KDecoration3::Decoration::bordersChanged, this, &Decoration::updateTitleBar);
-    connect(c, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::updateTitleBar);
-    connect(c, &KDecoration3::DecoratedWindow::widthChanged, this, &Decoration::updateTitleBar);
-    connect(c, &KDecoration3::DecoratedWindow::sizeChanged, this, &Decoration::updateBlur);
-
-    connect(c, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::updateTitleBar);
-    connect(c, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::updateOpaque);
-
-    connect(c, &KDecoration3::DecoratedWindow::widthChanged, this, &Decoration::updateButtonsGeometry);
-    connect(c, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::updateButtonsGeometry);
-    connect(c, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::updateButtonsGeometry);
-    connect(c, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::updateButtonsGeometry);
+    connect(c, &KDecoration3::DecoratedWindow::activeChanged, this, [this]() {
+        scheduleGeometryUpdate(GeometryUpdateOpaque | GeometryUpdateBlur);
+    });
+    connect(this, &KDecoration3::Decoration::bordersChanged, this, [this]() {
+        scheduleGeometryUpdate(GeometryUpdateTitleBar);
+    });
+    connect(c, &KDecoration3::DecoratedWindow::widthChanged, this, [this]() {
+        scheduleGeometryUpdate(GeometryUpdateTitleBar | GeometryUpdateButtons);
+    });
+    connect(c, &KDecoration3::DecoratedWindow::sizeChanged, this, [this]() {
+        scheduleGeometryUpdate(GeometryUpdateBlur);
+    });
+    connect(c, &KDecoration3::DecoratedWindow::maximizedChanged, this, [this]() {
+        scheduleGeometryUpdate(GeometryUpdateTitleBar | GeometryUpdateOpaque | GeometryUpdateButtons);
+    });
 
     createButtons();
     updateShadow();
@@ -444,6 +514,70 @@ void Decoration::updateTitleBar()
     setTitleBar(QRectF(x, y, width, height));
 }
 
+//________________________________________________________________
+void Decoration::scheduleGeometryUpdate(GeometryUpdates updates)
+{
+    // count each requested step, so that those absorbed by an already pending step show up as eliminated
+    for (int step = GeometryUpdateTitleBar; step <= GeometryUpdateShadow; step <<= 1) {
+        if (updates.testFlag(GeometryUpdate(step))) {
+            ++s_geometryUpdateStatistics.requested;
+        }
+    }
+
+    m_pendingGeometryUpdates |= updates;
+
+    // steps requested while a pass is running are picked up by that pass, or by a follow-up one
+    if (!m_geometryUpdateQueued && !m_flushingGeometryUpdates) {
+        m_geometryUpdateQueued = true;
+        QMetaObject::invokeMethod(this, &Decoration::flushGeometryUpdates, Qt::QueuedConnection);
+    }
+}
+
+//________________________________________________________________
+void Decoration::flushGeometryUpdates()
+{
+    m_geometryUpdateQueued = false;
+    m_flushingGeometryUpdates = true;
+
+    // pending steps are read live, so that steps requested by an earlier one (e.g. bordersChanged -> title bar) run in the same pass
+    auto runStep = [this](GeometryUpdate step, const auto &function) {
+        if (m_pendingGeometryUpdates.testFlag(step)) {
+            m_pendingGeometryUpdates &= ~GeometryUpdates(step);
+            ++s_geometryUpdateStatistics.performed;
+            function();
+        }
+    };
+
+    runStep(GeometryUpdateTitleBar, [this]() {
+        updateTitleBar();
+    });
+    runStep(GeometryUpdateButtons, [this]() {
+        updateButtonsGeometry();
+    });
+    runStep(GeometryUpdateOpaque, [this]() {
+        updateOpaque();
+    });
+    runStep(GeometryUpdateBlur, [this]() {
+        updateBlur();
+    });
+    runStep(GeometryUpdateShadow, [this]() {
+        updateShadow();
+    });
+
+    m_flushingGeometryUpdates = false;
+
+#if HELIUM_DECORATION_DEBUG_MODE
+    qDebug() << "Geometry update steps requested:" << s_geometryUpdateStatistics.requested << "performed:" << s_geometryUpdateStatistics.performed
+             << "eliminated:" << s_geometryUpdateStatistics.eliminated();
+#endif
+
+    // steps re-requested after their turn in this pass get a follow-up pass
+    if (m_pendingGeometryUpdates) {
+        m_geometryUpdateQueued = true;
+        QMetaObject::invokeMethod(this, &Decoration::flushGeometryUpdates, Qt::QueuedConnection);
+    }
+}
+
 // For Titlebar active state and shadow animations only
 void Decoration::updateAnimationState()
 {
@@ -538,17 +672,23 @@ int Decoration::borderSize(bool bottom) const
 }
 
 //________________________________________________________________
-void Decoration::reconfigureMain(const bool noUpdateShadow)
+void Decoration::reconfigureMain(const bool noUpdateShadow, const bool reloadShared)
 {
+    HELIUM_TRACE_SCOPE("decoration", "Decoration::reconfigureMain");
+
     auto c = window();
 
-    SettingsProvider::self()->reconfigure();
+    if (reloadShared) {
+        SettingsProvider::self()->reconfigure();
+    }
     m_internalSettings = SettingsProvider::self()->internalSettings(this);
 
     QPalette clientPalette = c->palette();
     updateDecorationColors(clientPalette);
 
-    s_kdeGlobalConfig->reparseConfiguration();
+    if (reloadShared) {
+        s_kdeGlobalConfig->reparseConfiguration();
+    }
     if (KWindowSystem::isPlatformX11()) {
         // loads system ScaleFactor from ~/.config/kdeglobals
         const KConfigGroup cgKScreen(s_kdeGlobalConfig, QStringLiteral("KScreen"));
@@ -606,6 +746,15 @@ void Decoration::reconfigureMain(const bool noUpdateShadow)
     Q_EMIT reconfigured();
 }
 
+//________________________________________________________________
+void Decoration::reloadSharedConfiguration()
+{
+    SettingsProvider::self()->reconfigure();
+    if (s_kdeGlobalConfig) {
+        s_kdeGlobalConfig->reparseConfiguration();
+    }
+}
+
 void Decoration::updateDecorationColors(const QPalette &clientPalette, QByteArray uuid)
 {
     QPalette systemPalette = KColorScheme::createApplicationPalette(s_kdeGlobalConfig);
@@ -1122,6 +1271,8 @@ void Decoration::updateButtonsGeometry()
 //________________________________________________________________
 void Decoration::paint(QPainter *painter, const QRectF &repaintRegion)
 {
+    HELIUM_TRACE_SCOPE("decoration", "Decoration::paint");
+
     m_painting = true;
 
     // TODO: optimize based on repaintRegion
@@ -1222,52 +1373,31 @@ void Decoration::paintTitleBar(QPainter *painter, const QRectF &repaintRegion)
         return;
     }
 
-    painter->save();
-    painter->setPen(Qt::NoPen);
+    auto s = settings();
 
-    QColor titleBarColor(this->titleBarColor());
+    // the background and separator are blitted from cached layers. During the active state animation both layers are blended
+    const bool animated = !m_toolsAreaWillBeDrawn && m_animation->state() == QAbstractAnimation::Running;
+    const bool active = c->isActive();
+    const bool baseState = animated ? false : active;
+    const QPixmap &layer = titleBarLayer(baseState, painter);
 
-    if (titleBarColor.alpha() < 255) {
+    painter->save();
+    painter->setClipRect(m_titleRect, Qt::IntersectClip);
+
+    if (titleBarColorForState(baseState).alpha() < 255 || (animated && titleBarColorForState(true).alpha() < 255)) {
         // on certain fractional scales there is an overlap with the window content
-        // this overlap is visible when translucent unless CompositionMode_Source is set
+        // this overlap is visible when translucent unless CompositionMode_Source is set.
+        // With painter opacity, CompositionMode_Source also interpolates between both layers
         painter->setCompositionMode(QPainter::CompositionMode_Source);
     }
 
-    // render a linear gradient on title area
-    if (c->isActive() && m_internalSettings->drawBackgroundGradient()) {
-        QLinearGradient gradient(0, 0, 0, m_titleRect.height());
-        gradient.setColorAt(0.0, titleBarColor.lighter(120));
-        gradient.setColorAt(0.8, titleBarColor);
-        painter->setBrush(gradient);
-
+    painter->drawPixmap(m_titleRect.topLeft(), layer);
+    if (animated) {
+        painter->setOpacity(m_opacity);
+        painter->drawPixmap(m_titleRect.topLeft(), titleBarLayer(true, painter));
     } else {
-        painter->setBrush(titleBarColor);
-    }
-
-    auto s = settings();
-
-    painter->drawPath(m_titleBarPath);
-
-    // draw titlebar separator
-    const QColor titleBarSeparatorColor(this->titleBarSeparatorColor());
-    int separatorHeight;
-    if ((separatorHeight = titleBarSeparatorHeight()) && titleBarSeparatorColor.isValid()) {
-        // outline
-        painter->setRenderHint(QPainter::Antialiasing);
-        painter->setBrush(Qt::NoBrush);
-        QPen p(titleBarSeparatorColor);
-        p.setWidthF(qRound(devicePixelRatio(painter)));
-        p.setCosmetic(true);
-        p.setCapStyle(Qt::FlatCap);
-        painter->setPen(p);
-
-        qreal separatorYCoOrd = qreal(m_titleRect.bottom()) - qreal(separatorHeight) / 2;
-        if (m_internalSettings->useTitleBarColorForAllBorders()) {
-            painter->drawLine(QPointF(m_titleRect.bottomLeft().x() + borderLeft(), separatorYCoOrd),
-                              QPointF(m_titleRect.bottomRight().x() - borderRight(), separatorYCoOrd));
-        } else {
-            painter->drawLine(QPointF(m_titleRect.bottomLeft().x(), separatorYCoOrd), QPointF(m_titleRect.bottomRight().x(), separatorYCoOrd));
-        }
+        // only keep the layer of the other state while animating, as it is as large as the title bar
+        m_titleBarLayers[active ? 0 : 1].pixmap = QPixmap();
     }
 
     painter->restore();
@@ -1284,6 +1414,83 @@ void Decoration::paintTitleBar(QPainter *painter, const QRectF &repaintRegion)
     m_rightButtons->paint(painter, repaintRegion);
 }
 
+//________________________________________________________________
+const QPixmap &Decoration::titleBarLayer(const bool active, QPainter *painter)
+{
+    TitleBarLayer &layer = m_titleBarLayers[active ? 1 : 0];
+
+    const qreal devicePixelRatio = painter->device()->devicePixelRatioF();
+    const QColor color = titleBarColorForState(active);
+    const bool gradient = active && m_internalSettings->drawBackgroundGradient();
+
+    const QColor separatorColor = (active && m_internalSettings->drawTitleBarSeparator()) ? m_decorationColors->active()->buttonFocus : QColor();
+    const int separatorHeight = titleBarSeparatorHeight();
+    QLineF separatorLine;
+    if (separatorHeight && separatorColor.isValid()) {
+        qreal separatorYCoOrd = qreal(m_titleRect.bottom()) - qreal(separatorHeight) / 2;
+        if (m_internalSettings->useTitleBarColorForAllBorders()) {
+            separatorLine = QLineF(QPointF(m_titleRect.bottomLeft().x() + borderLeft(), separatorYCoOrd),
+                                   QPointF(m_titleRect.bottomRight().x() - borderRight(), separatorYCoOrd));
+        } else {
+            separatorLine = QLineF(QPointF(m_titleRect.bottomLeft().x(), separatorYCoOrd), QPointF(m_titleRect.bottomRight().x(), separatorYCoOrd));
+        }
+    }
+    const qreal separatorWidth = qRound(this->devicePixelRatio(painter));
+
+    if (!layer.pixmap.isNull() && layer.path == m_titleBarPath && layer.devicePixelRatio == devicePixelRatio && layer.renderHints == painter->renderHints()
+        && layer.color == color && layer.gradient == gradient && layer.separatorColor == separatorColor && layer.separatorLine == separatorLine
+        && layer.separatorWidth == separatorWidth) {
+        return layer.pixmap;
+    }
+
+    layer.path = m_titleBarPath;
+    layer.devicePixelRatio = devicePixelRatio;
+    layer.renderHints = painter->renderHints();
+    layer.color = color;
+    layer.gradient = gradient;
+    layer.separatorColor = separatorColor;
+    layer.separatorLine = separatorLine;
+    layer.separatorWidth = separatorWidth;
+
+    layer.pixmap = QPixmap((m_titleRect.size() * devicePixelRatio).toSize().expandedTo(QSize(1, 1)));
+    layer.pixmap.setDevicePixelRatio(devicePixelRatio);
+    layer.pixmap.fill(Qt::transparent);
+
+    QPainter p(&layer.pixmap);
+    p.setRenderHints(layer.renderHints);
+    p.translate(-m_titleRect.topLeft());
+    p.setPen(Qt::NoPen);
+
+    // render a linear gradient on title area
+    if (gradient) {
+        QLinearGradient linearGradient(0, 0, 0, m_titleRect.height());
+        linearGradient.setColorAt(0.0, color.lighter(120));
+        linearGradient.setColorAt(0.8, color);
+        p.setBrush(linearGradient);
+
+    } else {
+        p.setBrush(color);
+    }
+
+    p.drawPath(m_titleBarPath);
+
+    // draw titlebar separator
+    if (!separatorLine.isNull()) {
+        // outline
+        p.setRenderHint(QPainter::Antialiasing);
+        p.setBrush(Qt::NoBrush);
+        QPen pen(separatorColor);
+        pen.setWidthF(separatorWidth);
+        pen.setCosmetic(true);
+        pen.setCapStyle(Qt::FlatCap);
+        p.setPen(pen);
+        p.drawLine(separatorLine);
+    }
+
+    p.end();
+    return layer.pixmap;
+}
+
 // outputs the icon size + padding to make a small button, the actual icon size, and the background size to make a small button
 void Decoration::calculateIconSizes()
 {
@@ -1446,6 +1653,8 @@ QPair<QRectF, Qt::Alignment> Decoration::captionRect(const bool nextState) const
 //________________________________________________________________
 void Decoration::updateShadow(const bool forceUpdateCache, bool noCache, const bool isThinWindowOutlineOverride)
 {
+    HELIUM_TRACE_SCOPE("decoration", "Decoration::updateShadow");
+
     auto c = window();
 
     // if the decoration is painting, abandon setting the shadow.
@@ -1520,6 +1729,8 @@ void Decoration::updateShadow(const bool forceUpdateCache, bool noCache, const b
 //________________________________________________________________
 std::shared_ptr<KDecoration3::DecorationShadow> Decoration::createShadowObject(QColor shadowColor, const bool isThinWindowOutlineOverride)
 {
+    HELIUM_TRACE_SCOPE("decoration", "Decoration::createShadowObject");
+
     auto c = window();
 
     // determine when a window outline does not need to be drawn (even when set to none, sometimes needs to be drawn if there is an animation)
@@ -1534,48 +1745,19 @@ std::shared_ptr<KDecoration3::DecorationShadow> Decoration::createShadowObject(Q
         return nullptr;
     }
 
-    const CompositeShadowParams params = lookupShadowParams(m_internalSettings->shadowSize());
-
-    const QSize boxSize =
-        BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius).expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
+    // the blurred shadow is cached, so that only the thin window outline is drawn here
+    const bool topCornersOnly(hasNoBorders() && !m_internalSettings->roundBottomCornersWhenNoBorders() && !c->isShaded());
+    // colours mixed by the shadow animation are neither cached nor stored on disk
+    const bool persistent = !(m_shadowAnimation->state() == QAbstractAnimation::Running && m_shadowOpacity != 0.0 && m_shadowOpacity != 1.0);
+    const ShadowBase base = shadowBase(shadowColor, m_internalSettings->shadowSize(), m_scaledCornerRadius, topCornersOnly, persistent);
 
-    BoxShadowRenderer shadowRenderer;
-
-    shadowRenderer.setBorderRadius(m_scaledCornerRadius + 0.5);
-    shadowRenderer.setBoxSize(boxSize);
-    shadowRenderer.addShadow(params.shadow1.offset, params.shadow1.radius, ColorTools::alphaMix(shadowColor, params.shadow1.opacity));
-    shadowRenderer.addShadow(params.shadow2.offset, params.shadow2.radius, ColorTools::alphaMix(shadowColor, params.shadow2.opacity));
-
-    QImage shadowTexture = shadowRenderer.render();
+    QImage shadowTexture = base.image;
+    const QRectF outerRect = shadowTexture.rect();
+    const QRectF &innerRect = base.innerRect;
 
     QPainter painter(&shadowTexture);
     painter.setRenderHint(QPainter::Antialiasing);
 
-    const QRectF outerRect = shadowTexture.rect();
-
-    QRectF boxRect(QPoint(0, 0), boxSize);
-    boxRect.moveCenter(outerRect.center());
-
-    // Mask out inner rect.
-    const QMarginsF padding = QMarginsF(boxRect.left() - outerRect.left() - Metrics::Decoration_Shadow_Overlap - params.offset.x(),
-                                        boxRect.top() - outerRect.top() - Metrics::Decoration_Shadow_Overlap - params.offset.y(),
-                                        outerRect.right() - boxRect.right() - Metrics::Decoration_Shadow_Overlap + params.offset.x(),
-                                        outerRect.bottom() - boxRect.bottom() - Metrics::Decoration_Shadow_Overlap + params.offset.y());
-    const QRectF innerRect = outerRect - padding;
-
-    painter.setPen(Qt::NoPen);
-    painter.setBrush(Qt::black);
-    painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
-
-    QPainterPath roundedRectMask;
-    if (hasNoBorders() && !m_internalSettings->roundBottomCornersWhenNoBorders() && !c->isShaded()) {
-        roundedRectMask = GeometryTools::roundedPath(innerRect, CornersTop, m_scaledCornerRadius + 0.5);
-    } else {
-        roundedRectMask.addRoundedRect(innerRect, m_scaledCornerRadius + 0.5, m_scaledCornerRadius + 0.5);
-    }
-
-    painter.drawPath(roundedRectMask);
-
     // Draw Thin window outline
     if (!windowOutlineNone || isThinWindowOutlineOverride) {
         if (m_thinWindowOutline.isValid()) {
@@ -1621,7 +1803,7 @@ std::shared_ptr<KDecoration3::DecorationShadow> Decoration::createShadowObject(Q
             else
                 cornerRadius = m_scaledCornerRadius + outlineAdjustment; // else round corner slightly more to account for pen width
 
-            if (hasNoBorders() && !m_internalSettings->roundBottomCornersWhenNoBorders() && !c->isShaded()) {
+            if (topCornersOnly) {
                 outlinePath = GeometryTools::roundedPath(outlineRect, CornersTop, cornerRadius);
             } else {
                 outlinePath.addRoundedRect(outlineRect, cornerRadius, cornerRadius);
@@ -1633,7 +1815,7 @@ std::shared_ptr<KDecoration3::DecorationShadow> Decoration::createShadowObject(Q
     painter.end();
 
     auto ret = std::make_shared<KDecoration3::DecorationShadow>();
-    ret->setPadding(padding);
+    ret->setPadding(base.padding);
     ret->setInnerShadowRect(QRectF(outerRect.center(), QSizeF(1, 1)));
     ret->setShadow(shadowTexture);
     return ret;
@@ -85,6 +85,8 @@ public:
     }
 
     QColor titleBarColor(bool returnNonAnimatedColor = false) const;
+    //* non-animated title bar colour for the given active state
+    QColor titleBarColorForState(const bool active) const;
     QColor titleBarSeparatorColor() const;
     QColor fontColor(bool returnNonAnimatedColor = false) const;
     QColor overriddenOutlineColorAnimateIn() const;
@@ -160,6 +162,36 @@ public:
         return m_opacity;
     }
 
+    //*@name coalesced geometry updates
+    //@{
+    //* geometry update steps, in the order they are run
+    enum GeometryUpdate {
+        GeometryUpdateTitleBar = 1 << 0,
+        GeometryUpdateButtons = 1 << 1,
+        GeometryUpdateOpaque = 1 << 2,
+        GeometryUpdateBlur = 1 << 3,
+        GeometryUpdateShadow = 1 << 4,
+    };
+    Q_DECLARE_FLAGS(GeometryUpdates, GeometryUpdate)
+
+    //* process-wide counters of requested and performed geometry update steps
+    struct GeometryUpdateStatistics {
+        quint64 requested = 0;
+        quint64 performed = 0;
+
+        //* number of redundant steps eliminated by coalescing
+        quint64 eliminated() const
+        {
+            return requested - performed;
+        }
+    };
+
+    static const GeometryUpdateStatistics &geometryUpdateStatistics()
+    {
+        return s_geometryUpdateStatistics;
+    }
+    //@}
+
 Q_SIGNALS:
     void reconfigured();
 
@@ -189,22 +221,28 @@ private Q_SLOTS:
     void updateButtonsGeometryDelayed();
     void updateTitleBar();
     void updateAnimationState();
-    void updateShadowOnShadedChange()
-    {
-        updateShadow();
-    }
     void onTabletModeChanged(bool mode);
+    void flushGeometryUpdates();
 
 private:
+    //* record geometry update steps, to be run once in a single ordered pass on the next event loop turn
+    void scheduleGeometryUpdate(GeometryUpdates updates);
+
     //* return the rect in which caption will be drawn
     QPair<QRectF, Qt::Alignment> captionRect(const bool nextState = false) const;
 
-    void reconfigureMain(const bool noUpdateShadow = false);
+    void reconfigureMain(const bool noUpdateShadow = false, const bool reloadShared = true);
+
+    //* reload the configuration shared by all decorations
+    static void reloadSharedConfiguration();
     void updateDecorationColors(const QPalette &clientPalette, QByteArray uuid = "");
     void createButtons();
     void calculateWindowShape();
     void calculateTitleBarShape();
     void paintTitleBar(QPainter *painter, const QRectF &repaintRegion);
+
+    //* title bar background and separator for the given active state, rendered at the painter's scale
+    const QPixmap &titleBarLayer(const bool active, QPainter *painter);
     void updateShadow(const bool forceUpdateCache = false, bool noCache = false, const bool isThinWindowOutlineOverride = false);
     std::shared_ptr<KDecoration3::DecorationShadow> createShadowObject(QColor shadowColor, const bool isThinWindowOutlineOverride = false);
     void setScaledCornerRadius();
@@ -281,6 +319,22 @@ private:
     //* Exact window path, with clipped rounded corners
     QPainterPath m_windowPath = QPainterPath();
 
+    //* cached title bar background, and everything it was rendered from
+    struct TitleBarLayer {
+        QPainterPath path;
+        qreal devicePixelRatio = 0;
+        QPainter::RenderHints renderHints;
+        QColor color;
+        bool gradient = false;
+        QColor separatorColor;
+        QLineF separatorLine;
+        qreal separatorWidth = 0;
+        QPixmap pixmap;
+    };
+
+    //* title bar layers, for the inactive and active states
+    TitleBarLayer m_titleBarLayers[2];
+
     qreal m_systemScaleFactorX11 = 1.0;
 
     ButtonBackgroundType m_buttonBackgroundType = ButtonBackgroundType::Small;
@@ -300,8 +354,21 @@ private:
     QColor m_originalThinWindowOutlineInactivePreOverride = QColor();
     //*flag to animate out an overridden thin window outline
     bool m_animateOutOverriddenThinWindowOutline = false;
+
+    //* geometry update steps waiting for the next pass
+    GeometryUpdates m_pendingGeometryUpdates;
+    //* whether a geometry update pass is queued
+    bool m_geometryUpdateQueued = false;
+    //* whether a geometry update pass is running
+    bool m_flushingGeometryUpdates = false;
+
+    static GeometryUpdateStatistics s_geometryUpdateStatistics;
+
+    friend class DBusSubscriptionHub;
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(Decoration::GeometryUpdates)
+
 bool Decoration::hasBorders() const
 {
     if (m_internalSettings && m_internalSettings->exceptionBorder()) {
@@ -8,7 +8,7 @@
 #include "breezesettingsprovider.h"
 #include "dbusmessages.h"
 #include "decorationexceptionlist.h"
-#include "presetsmodel.h"
+#include "tracing.h"
 
 #include <QRegularExpression>
 #include <QTextStream>
@@ -52,11 +52,19 @@ void SettingsProvider::reconfigure()
     exceptions.readConfig(m_config);
     m_exceptions = exceptions.getDefault();
     m_exceptions.append(exceptions.get());
+
+    // presets may have been edited since they were indexed
+    if (m_presetsConfig) {
+        m_presetsConfig->reparseConfiguration();
+    }
+    m_presetsIndex.invalidate();
 }
 
 //__________________________________________________________________
 InternalSettingsPtr SettingsProvider::internalSettings(Decoration *decoration)
 {
+    HELIUM_TRACE_SCOPE("decoration", "SettingsProvider::internalSettings");
+
     // get the client
     auto client = decoration->window();
 
@@ -101,16 +109,17 @@ InternalSettingsPtr SettingsProvider::internalSettings(Decoration *decoration)
                 if (!m_presetsConfig) {
                     return internalSettings;
                 }
+                if (!m_presetsIndex.isValid()) {
+                    m_presetsIndex.rebuild(m_presetsConfig.data());
+                }
 
                 // load the preset values into internalSettings if a preset is set as an exception
-                PresetsModel::loadPreset(internalSettings.data(), m_presetsConfig.data(), internalSettings->exceptionPreset());
+                m_presetsIndex.loadPreset(internalSettings.data(), internalSettings->exceptionPreset());
 
                 // if a border size exception is not set then replace it with the KwinBorderSize value from the preset
                 if ((!internalSettings->exceptionBorder())) {
-                    if (PresetsModel::presetHasKwinBorderSizeKey(m_presetsConfig.data(), internalSettings->exceptionPreset())) {
-                        PresetsModel::copyKwinBorderSizeFromPresetToExceptionBorderSize(internalSettings.data(),
-                                                                                        m_presetsConfig.data(),
-                                                                                        internalSettings->exceptionPreset());
+                    if (m_presetsIndex.presetHasKwinBorderSizeKey(internalSettings->exceptionPreset())) {
+                        m_presetsIndex.copyKwinBorderSizeFromPresetToExceptionBorderSize(internalSettings.data(), internalSettings->exceptionPreset());
                         internalSettings->setExceptionBorder(true);
                     }
                 }
@@ -9,6 +9,7 @@
 #include "breeze.h"
 #include "breezedecoration.h"
 #include "breezesettings.h"
+#include "presetsindex.h"
 
 #include <KSharedConfig>
 
@@ -52,6 +53,9 @@ private:
     //* presets config object
     KSharedConfigPtr m_presetsConfig;
 
+    //* presets parsed from m_presetsConfig, rebuilt on reconfigure
+    PresetsIndex m_presetsIndex;
+
     //* singleton
     static SettingsProvider *s_self;
 };
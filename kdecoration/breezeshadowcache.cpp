@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "breezeshadowcache.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QThreadPool>
+
+#include <cstring>
+#include <memory>
+
+namespace Breeze
+{
+
+//________________________________________________________________
+size_t qHash(const ShadowBaseKey &key, size_t seed)
+{
+    return qHashMulti(seed, key.color, key.size, key.cornerRadius + 0.0, key.topCornersOnly);
+}
+
+namespace ShadowDiskCache
+{
+
+//* identifies shadow cache files
+static constexpr quint32 magic = 0x484c5348; // "HLSH"
+
+//* bump whenever the shadow parameters, the renderer or the file layout change
+static constexpr quint32 version = 1;
+
+//* maximum total size of the cache directory, in bytes
+static constexpr qint64 maxCacheSize = 4 * 1024 * 1024;
+
+//* runs writes and evictions one at a time, off the GUI thread
+class WriterPool : public QThreadPool
+{
+public:
+    WriterPool()
+    {
+        setMaxThreadCount(1);
+    }
+};
+
+//________________________________________________________________
+static QThreadPool *writerPool()
+{
+    // being static, the pool waits for pending writes before the plugin is unloaded
+    static WriterPool pool;
+    return &pool;
+}
+
+//* file header, followed by the pixels
+struct FileHeader {
+    quint32 magic;
+    quint32 version;
+    qint32 width;
+    qint32 height;
+    qint32 bytesPerLine;
+    qint32 reserved;
+    double padding[4];
+    double innerRect[4];
+};
+
+//________________________________________________________________
+static QString cacheDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QStringLiteral("/helium/shadows");
+}
+
+//________________________________________________________________
+static QString filePath(const ShadowBaseKey &key)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << version << key.color << key.size << key.cornerRadius << key.topCornersOnly;
+
+    const QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex();
+    return cacheDirectory() + QLatin1Char('/') + QString::fromLatin1(hash) + QStringLiteral(".shadow");
+}
+
+//________________________________________________________________
+static void evict()
+{
+    QDir dir(cacheDirectory());
+
+    // newest first
+    const QFileInfoList files = dir.entryInfoList({QStringLiteral("*.shadow")}, QDir::Files, QDir::Time);
+
+    qint64 totalSize = 0;
+    for (const QFileInfo &file : files) {
+        totalSize += file.size();
+        if (totalSize > maxCacheSize) {
+            QFile::remove(file.absoluteFilePath());
+        }
+    }
+}
+
+//________________________________________________________________
+bool load(const ShadowBaseKey &key, ShadowBase &base)
+{
+    auto file = std::make_unique<QFile>(filePath(key));
+    if (!file->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 size = file->size();
+    if (size < qint64(sizeof(FileHeader))) {
+        return false;
+    }
+
+    const uchar *data = file->map(0, size);
+    if (!data) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(FileHeader));
+    if (header.magic != magic || header.version != version || header.width <= 0 || header.height <= 0 || header.bytesPerLine < header.width * 4
+        || size != qint64(sizeof(FileHeader)) + qint64(header.bytesPerLine) * header.height) {
+        return false;
+    }
+
+    // the image reads the pixels straight from the mapping, which lives as long as the image does.
+    // Files are only ever replaced atomically, so the mapping stays valid even if the cache is rewritten
+    QFile *mappedFile = file.release();
+    base.image = QImage(
+        data + sizeof(FileHeader),
+        header.width,
+        header.height,
+        header.bytesPerLine,
+        QImage::Format_ARGB32_Premultiplied,
+        [](void *info) {
+            delete static_cast<QFile *>(info);
+        },
+        mappedFile);
+    base.padding = QMarginsF(header.padding[0], header.padding[1], header.padding[2], header.padding[3]);
+    base.innerRect = QRectF(header.innerRect[0], header.innerRect[1], header.innerRect[2], header.innerRect[3]);
+    return !base.image.isNull();
+}
+
+//________________________________________________________________
+static void write(const ShadowBaseKey &key, const ShadowBase &base)
+{
+    if (!QDir().mkpath(cacheDirectory())) {
+        return;
+    }
+
+    const QImage image = base.image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    FileHeader header;
+    header.magic = magic;
+    header.version = version;
+    header.width = image.width();
+    header.height = image.height();
+    header.bytesPerLine = image.bytesPerLine();
+    header.reserved = 0;
+    header.padding[0] = base.padding.left();
+    header.padding[1] = base.padding.top();
+    header.padding[2] = base.padding.right();
+    header.padding[3] = base.padding.bottom();
+    header.innerRect[0] = base.innerRect.x();
+    header.innerRect[1] = base.innerRect.y();
+    header.innerRect[2] = base.innerRect.width();
+    header.innerRect[3] = base.innerRect.height();
+
+    QSaveFile file(filePath(key));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+    file.write(reinterpret_cast<const char *>(image.constBits()), image.sizeInBytes());
+    if (file.commit()) {
+        evict();
+    }
+}
+
+//________________________________________________________________
+void store(const ShadowBaseKey &key, const ShadowBase &base)
+{
+    if (base.image.isNull()) {
+        return;
+    }
+
+    // the copy shares the pixels, and detaches should the caller paint over its own image
+    writerPool()->start([key, base] {
+        write(key, base);
+    });
+}
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QImage>
+#include <QMarginsF>
+#include <QRectF>
+#include <QRgb>
+
+namespace Breeze
+{
+
+//* identifies a blurred shadow texture, before the thin window outline is drawn over it
+struct ShadowBaseKey {
+    QRgb color;
+    int size;
+    qreal cornerRadius;
+    bool topCornersOnly;
+
+    bool operator==(const ShadowBaseKey &other) const
+    {
+        return color == other.color && size == other.size && cornerRadius == other.cornerRadius && topCornersOnly == other.topCornersOnly;
+    }
+};
+
+size_t qHash(const ShadowBaseKey &key, size_t seed = 0);
+
+//* blurred shadow texture with the window masked out, and its geometry
+struct ShadowBase {
+    QImage image;
+    QMarginsF padding;
+    QRectF innerRect;
+};
+
+/**
+ * @brief Persistent cache of blurred shadow textures under $XDG_CACHE_HOME/helium/shadows, so that shadows survive KWin restarts.
+ *        Textures are stored as raw premultiplied ARGB32 and memory-mapped when read back.
+ *        The directory is kept under a fixed size by evicting the least recently written textures.
+ */
+namespace ShadowDiskCache
+{
+//* loads the texture for the given key. Returns false if it is not cached, or if the cached file is not valid
+bool load(const ShadowBaseKey &, ShadowBase &);
+
+//* stores the texture for the given key, and evicts old textures if the cache grows too large. Files are written asynchronously
+void store(const ShadowBaseKey &, const ShadowBase &);
+}
+
+}
@@ -9,10 +9,31 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "breezestackedwidgetdata.h"
+#include "breeze_transitions_logging.h"
+
+#include <QElapsedTimer>
 
 namespace Breeze
 {
 
+//* time available to render one frame, in milliseconds
+static constexpr qreal frameBudget = 16;
+
+//* weight of the last sample in moving averages
+static constexpr qreal movingAverageWeight = 0.25;
+
+//* downscale factor applied to each dimension of downscaled transitions
+static constexpr int downscaleFactor = 2;
+
+//* number of consecutive skipped transitions after which costs are measured again
+static constexpr int reprobeInterval = 8;
+
+//______________________________________________________
+static qreal movingAverage(qreal average, qreal sample)
+{
+    return average < 0 ? sample : average + movingAverageWeight * (sample - average);
+}
+
 //______________________________________________________
 StackedWidgetData::StackedWidgetData(QObject *parent, QStackedWidget *target, int duration)
     : TransitionData(parent, target, duration)
@@ -52,13 +73,56 @@ bool StackedWidgetData::initializeAnimation()
 
     // get old widget (matching _index) and initialize transition
     if (QWidget *widget = _target.data()->widget(_index)) {
+        updateFrameCost();
+
+        // skip the transition altogether, before grabbing anything, if it is expected to cost more than it is worth
+        const qreal megaPixels(qreal(widget->width()) * widget->height() / 1e6);
+        const TransitionMode mode(transitionMode(megaPixels));
+        _lastMode = mode;
+        _lastMegaPixels = megaPixels;
+        if (mode == TransitionMode::Skipped) {
+            // a skipped transition measures nothing, so forget the costs from time to time
+            // for a single slow sample not to disable transitions for good
+            if (++_skippedCount >= reprobeInterval) {
+                qCDebug(HELIUM_TRANSITIONS) << "StackedWidgetData::initializeAnimation: measuring transition costs again for" << _target.data();
+                _skippedCount = 0;
+                _grabCost = -1;
+                _frameCost = -1;
+                _downscaledFrameCost = -1;
+            }
+
+            _index = _target.data()->currentIndex();
+            return false;
+        }
+
+        _skippedCount = 0;
+
         transition().data()->setOpacity(0);
         startClock();
         transition().data()->setGeometry(widget->geometry());
-        transition().data()->setStartPixmap(transition().data()->grab(widget));
+
+        QElapsedTimer timer;
+        timer.start();
+        QPixmap pixmap(transition().data()->grab(widget));
+        if (megaPixels > 0) {
+            _grabCost = movingAverage(_grabCost, timer.nsecsElapsed() / 1e6 / megaPixels);
+        }
+
+        if (mode == TransitionMode::Downscaled && !pixmap.isNull()) {
+            pixmap = pixmap.scaled(pixmap.size() / downscaleFactor, Qt::IgnoreAspectRatio, Qt::FastTransformation);
+        }
+
+        transition().data()->setFlag(TransitionWidget::Downscaled, mode == TransitionMode::Downscaled);
+        transition().data()->setStartPixmap(pixmap);
 
         _index = _target.data()->currentIndex();
-        return !slow();
+        if (slow()) {
+            // not animated, so there is no frame cost to measure
+            _lastMode = TransitionMode::Skipped;
+            return false;
+        }
+
+        return true;
 
     } else {
         _index = _target.data()->currentIndex();
@@ -66,6 +130,55 @@ bool StackedWidgetData::initializeAnimation()
     }
 }
 
+//___________________________________________________________________
+StackedWidgetData::TransitionMode StackedWidgetData::transitionMode(qreal megaPixels) const
+{
+    // grabbing delays the page switch itself
+    const qreal grabCost(_grabCost * megaPixels);
+    if (grabCost > frameBudget) {
+        qCDebug(HELIUM_TRANSITIONS) << "StackedWidgetData::transitionMode: skipping transition for" << _target.data()
+                                    << "- projected grab time:" << grabCost << "ms";
+        return TransitionMode::Skipped;
+    }
+
+    // fading is paid on every frame of the transition
+    const qreal frameCost(_frameCost * megaPixels);
+    if (frameCost <= frameBudget) {
+        return TransitionMode::Full;
+    }
+
+    const qreal downscaledFrameCost(_downscaledFrameCost * megaPixels);
+    if (downscaledFrameCost <= frameBudget) {
+        qCDebug(HELIUM_TRANSITIONS) << "StackedWidgetData::transitionMode: downscaling transition for" << _target.data()
+                                    << "- projected frame time:" << frameCost << "ms";
+        return TransitionMode::Downscaled;
+    }
+
+    qCDebug(HELIUM_TRANSITIONS) << "StackedWidgetData::transitionMode: skipping transition for" << _target.data()
+                                << "- projected downscaled frame time:" << downscaledFrameCost << "ms";
+    return TransitionMode::Skipped;
+}
+
+//___________________________________________________________________
+void StackedWidgetData::updateFrameCost()
+{
+    if (_lastMode == TransitionMode::Skipped || _lastMegaPixels <= 0) {
+        return;
+    }
+
+    const qreal paintTime(transition().data()->averagePaintTime());
+    if (paintTime < 0) {
+        return;
+    }
+
+    const qreal sample(paintTime / _lastMegaPixels);
+    if (_lastMode == TransitionMode::Full) {
+        _frameCost = movingAverage(_frameCost, sample);
+    } else {
+        _downscaledFrameCost = movingAverage(_downscaledFrameCost, sample);
+    }
+}
+
 //___________________________________________________________________
 bool StackedWidgetData::animate()
 {
@@ -41,11 +41,47 @@ protected Q_SLOTS:
     void targetDestroyed();
 
 private:
+    //* how a page switch is rendered
+    enum class TransitionMode {
+        Full,
+        Downscaled,
+        Skipped,
+    };
+
+    //* pick transition mode for a page of given area, from the costs measured so far
+    TransitionMode transitionMode(qreal megaPixels) const;
+
+    //* fold the paint cost of the last transition into the moving averages
+    void updateFrameCost();
+
     //* target
     WeakPointer<QStackedWidget> _target;
 
     //* current index
     int _index;
+
+    //*@name moving averages, in milliseconds per megapixel. Negative until measured
+    //@{
+
+    //* grabbing the outgoing page
+    qreal _grabCost = -1;
+
+    //* painting one frame of a full resolution transition
+    qreal _frameCost = -1;
+
+    //* painting one frame of a downscaled transition
+    qreal _downscaledFrameCost = -1;
+
+    //@}
+
+    //* mode of the last transition
+    TransitionMode _lastMode = TransitionMode::Skipped;
+
+    //* page area of the last transition, in megapixels
+    qreal _lastMegaPixels = 0;
+
+    //* number of consecutive skipped transitions
+    int _skippedCount = 0;
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include "breezetransitionwidget.h"
 
+#include <QElapsedTimer>
 #include <QPaintEvent>
 #include <QPainter>
 #include <QStyleOption>
@@ -108,6 +109,10 @@ void TransitionWidget::paintEvent(QPaintEvent *event)
         return;
     }
 
+    // measure frame cost
+    QElapsedTimer timer;
+    timer.start();
+
     // get rect
     QRect rect = event->rect();
     if (!rect.isValid()) {
@@ -158,7 +163,13 @@ void TransitionWidget::paintEvent(QPaintEvent *event)
 
         // draw fading start pixmap
         if (opacity() <= 0.996 && !_startPixmap.isNull()) {
-            if (opacity() >= 0.004) {
+            if (testFlag(Downscaled) && _startPixmap.size() != size()) {
+                // downscaled pixmap is stretched over the widget, with painter opacity, so that no full size pixmap is faded
+                p.setOpacity(1.0 - opacity());
+                p.drawPixmap(this->rect(), _startPixmap);
+                p.setOpacity(1.0);
+
+            } else if (opacity() >= 0.004) {
                 fade(_startPixmap, _localStartPixmap, 1.0 - opacity(), rect);
                 p.drawPixmap(QPoint(), _localStartPixmap);
 
@@ -177,6 +188,9 @@ void TransitionWidget::paintEvent(QPaintEvent *event)
         p.drawPixmap(QPoint(0, 0), _currentPixmap);
         p.end();
     }
+
+    _paintTime += timer.nsecsElapsed() / 1e6;
+    ++_paintCount;
 }
 
 //________________________________________________
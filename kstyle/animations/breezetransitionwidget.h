@@ -42,6 +42,7 @@ public:
         GrabFromWindow = 1 << 0,
         Transparent = 1 << 1,
         PaintOnWidget = 1 << 2,
+        Downscaled = 1 << 3,
     };
 
     Q_DECLARE_FLAGS(Flags, Flag)
@@ -158,6 +159,12 @@ public:
     //* grap pixmap
     QPixmap grab(QWidget * = nullptr, QRect = QRect());
 
+    //* average time spent painting a frame since the last call to animate, in milliseconds. Negative if nothing was painted
+    qreal averagePaintTime() const
+    {
+        return _paintCount > 0 ? _paintTime / _paintCount : -1;
+    }
+
     //* true if animated
     bool isAnimated() const
     {
@@ -178,6 +185,8 @@ public:
         if (_animation.data()->isRunning()) {
             _animation.data()->stop();
         }
+        _paintTime = 0;
+        _paintCount = 0;
         _animation.data()->start();
     }
 
@@ -239,6 +248,12 @@ private:
     //* current state opacity
     qreal _opacity = 0;
 
+    //* time spent painting frames since the last call to animate, in milliseconds
+    qreal _paintTime = 0;
+
+    //* number of frames painted since the last call to animate
+    int _paintCount = 0;
+
     //* steps
     static int _steps;
 };
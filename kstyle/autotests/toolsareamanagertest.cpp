@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezetoolsareamanager.h"
+
+#include <QMainWindow>
+#include <QTest>
+#include <QToolBar>
+
+using namespace Breeze;
+
+class ToolsAreaManagerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testEventsWithoutWalk();
+    void testFloatingToolBar();
+    void testToolBarMovedToOtherWindow();
+};
+
+//____________________________________________________________________
+void ToolsAreaManagerTest::testEventsWithoutWalk()
+{
+    // the helper is only used when the configuration is reloaded
+    ToolsAreaManager manager(nullptr);
+
+    QMainWindow window;
+    QToolBar *toolBar = window.addToolBar(QStringLiteral("top"));
+    manager.registerWidget(&window);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    const int walks = manager.parentWalkCount();
+
+    // events seen by the filter on the main window and its toolbar, which are not reparenting the toolbar
+    window.resize(window.size() + QSize(10, 10));
+    toolBar->setWindowTitle(QStringLiteral("renamed"));
+    toolBar->hide();
+    toolBar->show();
+
+    auto bottomToolBar = new QToolBar(QStringLiteral("bottom"));
+    window.addToolBar(Qt::BottomToolBarArea, bottomToolBar);
+    delete bottomToolBar;
+    QCoreApplication::processEvents();
+
+    QCOMPARE(manager.parentWalkCount(), walks);
+}
+
+//____________________________________________________________________
+void ToolsAreaManagerTest::testFloatingToolBar()
+{
+    ToolsAreaManager manager(nullptr);
+
+    QMainWindow window;
+    QToolBar *toolBar = window.addToolBar(QStringLiteral("top"));
+    manager.registerWidget(&window);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(manager.toolsAreaRect(window).height() > 0);
+
+    // floating keeps the toolbar in its main window, and costs a single walk
+    const int walks = manager.parentWalkCount();
+    toolBar->setWindowFlags(Qt::Tool | Qt::FramelessWindowHint);
+    QCOMPARE(manager.parentWalkCount(), walks + 1);
+
+    toolBar->setWindowFlags(Qt::Widget);
+    QCOMPARE(manager.parentWalkCount(), walks + 2);
+
+    toolBar->show();
+    QCoreApplication::processEvents();
+    QVERIFY(manager.toolsAreaRect(window).height() > 0);
+}
+
+//____________________________________________________________________
+void ToolsAreaManagerTest::testToolBarMovedToOtherWindow()
+{
+    ToolsAreaManager manager(nullptr);
+
+    QMainWindow window;
+    QToolBar *toolBar = window.addToolBar(QStringLiteral("top"));
+    manager.registerWidget(&window);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(manager.toolsAreaRect(window).height() > 0);
+
+    // the previous window is notified with ChildRemoved, which must not walk again
+    const int walks = manager.parentWalkCount();
+    QMainWindow otherWindow;
+    otherWindow.addToolBar(toolBar);
+    QCoreApplication::processEvents();
+    QCOMPARE(manager.parentWalkCount(), walks + 1);
+    QCOMPARE(manager.toolsAreaRect(window).height(), 0);
+}
+
+QTEST_MAIN(ToolsAreaManagerTest)
+
+#include "toolsareamanagertest.moc"
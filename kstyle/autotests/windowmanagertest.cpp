@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezewindowmanager.h"
+
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QTest>
+
+using namespace Breeze;
+
+class WindowManagerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testQuickWindowRegistration();
+};
+
+//____________________________________________________________________
+void WindowManagerTest::testQuickWindowRegistration()
+{
+    WindowManager manager;
+    QCOMPARE(manager.quickWindowFilterInstallCount(), 0);
+    QCOMPARE(manager.quickWindowRegistrationCount(), 0);
+
+    auto window = new QQuickWindow;
+    auto first = new QQuickItem(window->contentItem());
+    auto second = new QQuickItem(window->contentItem());
+    auto nested = new QQuickItem(second);
+
+    // every control of the window registers itself when polished, and again on repolish
+    for (int i = 0; i < 10; ++i) {
+        manager.registerQuickItem(first);
+        manager.registerQuickItem(second);
+        manager.registerQuickItem(nested);
+    }
+    QCOMPARE(manager.quickWindowFilterInstallCount(), 1);
+    QCOMPARE(manager.quickWindowRegistrationCount(), 1);
+
+    auto otherWindow = new QQuickWindow;
+    manager.registerQuickItem(new QQuickItem(otherWindow->contentItem()));
+    QCOMPARE(manager.quickWindowFilterInstallCount(), 2);
+    QCOMPARE(manager.quickWindowRegistrationCount(), 2);
+
+    delete window;
+    QCOMPARE(manager.quickWindowRegistrationCount(), 1);
+
+    delete otherWindow;
+    QCOMPARE(manager.quickWindowRegistrationCount(), 0);
+
+    // items without a window are ignored
+    QQuickItem orphan;
+    manager.registerQuickItem(&orphan);
+    QCOMPARE(manager.quickWindowFilterInstallCount(), 2);
+    QCOMPARE(manager.quickWindowRegistrationCount(), 0);
+}
+
+QTEST_MAIN(WindowManagerTest)
+
+#include "windowmanagertest.moc"
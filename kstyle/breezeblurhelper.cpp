@@ -20,8 +20,11 @@
 
 #include <QEvent>
 #include <QMenu>
+#include <QPlatformSurfaceEvent>
 #include <QVector>
 
+#include <utility>
+
 namespace Breeze
 {
 //___________________________________________________________
@@ -48,9 +51,70 @@ void BlurHelper::unregisterWidget(QWidget *widget)
     widget->removeEventFilter(this);
 }
 
+//___________________________________________________________
+void BlurHelper::setBlurRegion(QWidget *widget, const QRegion &region)
+{
+    widget->winId(); // force creation of the window handle
+
+    QWindow *window(widget->windowHandle());
+    if (!window) {
+        return;
+    }
+
+    _pendingRegions.insert(window, region);
+
+    if (!_flushQueued) {
+        _flushQueued = true;
+        QMetaObject::invokeMethod(this, &BlurHelper::flushBlurRegions, Qt::QueuedConnection);
+    }
+}
+
+//___________________________________________________________
+void BlurHelper::flushBlurRegions()
+{
+    _flushQueued = false;
+
+    const auto pendingRegions = std::exchange(_pendingRegions, {});
+    for (auto it = pendingRegions.constBegin(); it != pendingRegions.constEnd(); ++it) {
+        QWindow *window(it.key());
+
+        auto submitted = _submittedRegions.constFind(window);
+        if (submitted != _submittedRegions.constEnd()) {
+            if (submitted.value() == it.value()) {
+                continue;
+            }
+
+        } else {
+            // track the window, to forget the submitted region when its surface goes away
+            window->removeEventFilter(this);
+            window->installEventFilter(this);
+            connect(window, &QObject::destroyed, this, &BlurHelper::windowDestroyed, Qt::UniqueConnection);
+        }
+
+        KWindowEffects::enableBlurBehind(window, true, it.value());
+        _submittedRegions.insert(window, it.value());
+    }
+}
+
+//___________________________________________________________
+void BlurHelper::windowDestroyed(QObject *object)
+{
+    _submittedRegions.remove(object);
+    _pendingRegions.remove(static_cast<QWindow *>(object));
+}
+
 //___________________________________________________________
 bool BlurHelper::eventFilter(QObject *object, QEvent *event)
 {
+    if (object->isWindowType()) {
+        // a new surface does not carry the blur region over, so it must be submitted again
+        if (event->type() == QEvent::PlatformSurface
+            && static_cast<QPlatformSurfaceEvent *>(event)->surfaceEventType() == QPlatformSurfaceEvent::SurfaceAboutToBeDestroyed) {
+            _submittedRegions.remove(object);
+        }
+        return false;
+    }
+
     switch (event->type()) {
     case QEvent::Hide:
     case QEvent::Show:
@@ -75,7 +139,7 @@ bool BlurHelper::eventFilter(QObject *object, QEvent *event)
 }
 
 //___________________________________________________________
-void BlurHelper::update(QWidget *widget) const
+void BlurHelper::update(QWidget *widget)
 {
     /*
     directly from bespin code. Supposedly prevent playing with some 'pseudo-widgets'
@@ -85,13 +149,11 @@ void BlurHelper::update(QWidget *widget) const
         return;
     }
 
-    widget->winId(); // force creation of the window handle
-
     QRegion region;
     if (const auto menu = qobject_cast<QMenu *>(widget)) {
         region = _helper->menuFrameRegion(menu);
     }
-    KWindowEffects::enableBlurBehind(widget->windowHandle(), true, region);
+    setBlurRegion(widget, region);
 
     // force update
     if (widget->isVisible()) {
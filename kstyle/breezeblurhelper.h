@@ -19,6 +19,9 @@
 
 #include <QHash>
 #include <QObject>
+#include <QPointer>
+#include <QRegion>
+#include <QWindow>
 
 namespace Breeze
 {
@@ -36,9 +39,23 @@ public:
     //! register widget
     void unregisterWidget(QWidget *);
 
+    //! request blur behind the given region of the widget's window
+    /*!
+    requests are deferred to a single flush once the current event, typically a paint, has been processed,
+    and only sent to the compositor when the region differs from the one last submitted for that window
+    */
+    void setBlurRegion(QWidget *, const QRegion &);
+
     //! event filter
     bool eventFilter(QObject *, QEvent *) override;
 
+protected Q_SLOTS:
+    //! submit pending blur regions that changed
+    void flushBlurRegions();
+
+    //! triggered by window destruction
+    void windowDestroyed(QObject *);
+
 protected:
     //! install event filter to object, in a unique way
     void addEventFilter(QObject *object)
@@ -48,10 +65,19 @@ protected:
     }
 
     //! update blur regions for given widget
-    void update(QWidget *) const;
+    void update(QWidget *);
 
 private:
     std::shared_ptr<Helper> _helper;
+
+    //! regions waiting for the next flush
+    QHash<QWindow *, QRegion> _pendingRegions;
+
+    //! regions last sent to the compositor
+    QHash<const QObject *, QRegion> _submittedRegions;
+
+    //! true if a flush is queued
+    bool _flushQueued = false;
 };
 
 }
@@ -7,7 +7,6 @@
 
 #include "breezedecorationsettingsprovider.h"
 #include "decorationexceptionlist.h"
-#include "presetsmodel.h"
 
 #include <QRegularExpression>
 #include <QTextStream>
@@ -51,6 +50,12 @@ void DecorationSettingsProvider::reconfigure()
     exceptions.readConfig(m_config);
     m_exceptions = exceptions.getDefault();
     m_exceptions.append(exceptions.get());
+
+    // presets may have been edited since they were indexed
+    if (m_presetsConfig) {
+        m_presetsConfig->reparseConfiguration();
+    }
+    m_presetsIndex.invalidate();
 }
 
 //__________________________________________________________________
@@ -77,8 +82,11 @@ InternalSettingsPtr DecorationSettingsProvider::internalSettings()
                 if (!m_presetsConfig) {
                     return internalSettings;
                 }
+                if (!m_presetsIndex.isValid()) {
+                    m_presetsIndex.rebuild(m_presetsConfig.data());
+                }
 
-                PresetsModel::loadPreset(internalSettings.data(), m_presetsConfig.data(), internalSettings->exceptionPreset());
+                m_presetsIndex.loadPreset(internalSettings.data(), internalSettings->exceptionPreset());
                 internalSettings->setProperty("noCacheException",
                                               true); // this property is to indicate not to cache shadows or colours for an exception with a Preset
                                                      // -- this is because the Preset exception can alter shadows and colours
@@ -14,6 +14,7 @@
 
 #include "breeze.h"
 #include "breezesettings.h"
+#include "presetsindex.h"
 
 #include <KSharedConfig>
 #include <QMainWindow>
@@ -57,6 +58,9 @@ private:
     //* presets config object
     KSharedConfigPtr m_presetsConfig;
 
+    //* presets parsed from m_presetsConfig, rebuilt on reconfigure
+    PresetsIndex m_presetsIndex;
+
     //* singleton
     static DecorationSettingsProvider *s_self;
 };
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezeframetilecache.h"
+#include "breezepixelalignment.h"
+
+#include <QPainter>
+#include <QPixmap>
+#include <QtMath>
+
+#include <array>
+
+namespace Breeze
+{
+
+//* fixed point precision used for cache keys
+static constexpr qreal keyPrecision = 64;
+
+//______________________________________________________________
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const FrameTileKey &key, size_t seed)
+#else
+uint qHash(const FrameTileKey &key, uint seed)
+#endif
+{
+    const std::array<quint32, 6> data = {quint32(key.radius),
+                                         quint32(key.penWidth),
+                                         quint32(key.devicePixelRatio),
+                                         key.color,
+                                         key.outline,
+                                         quint32(key.hasColor) | (quint32(key.hasOutline) << 1)};
+    return qHashBits(data.data(), sizeof(data), seed);
+}
+
+//______________________________________________________________
+FrameTileCache::FrameTileCache(int maxCost)
+    : _tileSets(maxCost)
+{
+}
+
+//______________________________________________________________
+bool FrameTileCache::render(QPainter *painter, const QRectF &rect, qreal radius, const QColor &color, const QColor &outline, qreal penWidth)
+{
+    const bool hasColor(color.isValid() && color.alpha() > 0);
+    const bool hasOutline(outline.isValid());
+    if (!(hasColor || hasOutline)) {
+        return true;
+    }
+
+    qreal dpr;
+    if (!PixelAlignment::acceptsBlit(painter, rect, dpr)) {
+        return false;
+    }
+
+    TileSet *frameTileSet(tileSet(radius, color, outline, penWidth, dpr));
+    if (!frameTileSet) {
+        return false;
+    }
+
+    // rects smaller than the tileset would have their corners cropped
+    const QRect alignedRect(rect.toRect());
+    if (alignedRect.width() < frameTileSet->size().width() || alignedRect.height() < frameTileSet->size().height()) {
+        return false;
+    }
+
+    frameTileSet->render(alignedRect, painter, TileSet::Full);
+    return true;
+}
+
+//______________________________________________________________
+void FrameTileCache::warm(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal devicePixelRatio)
+{
+    tileSet(radius, color, outline, penWidth, devicePixelRatio);
+}
+
+//______________________________________________________________
+TileSet *FrameTileCache::tileSet(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal dpr)
+{
+    const bool hasColor(color.isValid() && color.alpha() > 0);
+    const bool hasOutline(outline.isValid());
+    if (!(hasColor || hasOutline)) {
+        return nullptr;
+    }
+
+    // tilesets are also created ahead of time for screen scale factors, which do not go through acceptsBlit
+    if (!PixelAlignment::isIntegerDevicePixelRatio(dpr)) {
+        return nullptr;
+    }
+
+    FrameTileKey key;
+    key.radius = qRound(radius * keyPrecision);
+    key.penWidth = hasOutline ? qRound(penWidth * keyPrecision) : 0;
+    key.devicePixelRatio = qRound(dpr * keyPrecision);
+    key.color = hasColor ? color.rgba() : 0;
+    key.outline = hasOutline ? outline.rgba() : 0;
+    key.hasColor = hasColor;
+    key.hasOutline = hasOutline;
+
+    TileSet *tileSet(_tileSets.object(key));
+    if (!tileSet) {
+        tileSet = createTileSet(radius, hasColor ? color : QColor(), hasOutline ? outline : QColor(), penWidth, dpr);
+        const int cost = qMax(1, tileSet->size().width() * tileSet->size().height() * int(dpr * dpr) * 4 / 1024);
+        _tileSets.insert(key, tileSet, cost);
+    }
+
+    return tileSet;
+}
+
+//______________________________________________________________
+TileSet *FrameTileCache::createTileSet(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal devicePixelRatio) const
+{
+    // corners must hold the full arc plus the pen, and one pixel of straight edge is kept in the middle
+    const int cornerSize(qCeil(radius + (outline.isValid() ? penWidth : 0)) + 1);
+    const int size(2 * cornerSize + 1);
+
+    QPixmap pixmap(QSize(size, size) * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    QRectF frameRect(0, 0, size, size);
+    if (outline.isValid()) {
+        painter.setPen(QPen(outline, penWidth));
+        const qreal adjustment(0.5 * penWidth);
+        frameRect.adjust(adjustment, adjustment, -adjustment, -adjustment);
+
+    } else {
+        painter.setPen(Qt::NoPen);
+    }
+
+    if (color.isValid()) {
+        painter.setBrush(color);
+    } else {
+        painter.setBrush(Qt::NoBrush);
+    }
+
+    painter.drawRoundedRect(frameRect, radius, radius);
+    painter.end();
+
+    return new TileSet(pixmap, cornerSize, cornerSize, 1, 1);
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "breezetileset.h"
+
+#include <QCache>
+#include <QColor>
+#include <QRectF>
+
+class QPainter;
+
+namespace Breeze
+{
+
+//* key identifying a rounded frame nine-patch
+struct FrameTileKey {
+    //* radius, pen width and device pixel ratio, in 1/64th of a pixel
+    int radius = 0;
+    int penWidth = 0;
+    int devicePixelRatio = 0;
+
+    //* colors. Invalid colors are stored with their validity flag cleared
+    QRgb color = 0;
+    QRgb outline = 0;
+    bool hasColor = false;
+    bool hasOutline = false;
+
+    bool operator==(const FrameTileKey &other) const
+    {
+        return radius == other.radius && penWidth == other.penWidth && devicePixelRatio == other.devicePixelRatio && color == other.color
+            && outline == other.outline && hasColor == other.hasColor && hasOutline == other.hasOutline;
+    }
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const FrameTileKey &, size_t seed = 0);
+#else
+uint qHash(const FrameTileKey &, uint seed = 0);
+#endif
+
+//* LRU cache of nine-patch tilesets used to blit antialiased rounded frames
+/**
+rounded frames are rendered once per radius, pen width, colors and device pixel ratio
+into a small pixmap, then stretched to the requested rect using TileSet::render.
+Frames that cannot be reproduced exactly by a nine-patch (fractional geometry, non
+translating transforms, fractional scale factors, rects smaller than the tileset)
+are rejected, and must be painted directly by the caller.
+*/
+class FrameTileCache
+{
+public:
+    //* constructor. Maximum cost is expressed in kilobytes of pixmap data
+    explicit FrameTileCache(int maxCost = 1024);
+
+    //* render frame from cache
+    /**
+    rect is the outer frame rect, before stroking. radius is the corner radius
+    of the (possibly stroked) rounded rect, as passed to QPainter::drawRoundedRect.
+    Returns false if the frame could not be rendered from cache.
+    */
+    bool render(QPainter *, const QRectF &rect, qreal radius, const QColor &color, const QColor &outline, qreal penWidth = 1);
+
+    //* create the tileset used to render frames with the given parameters, ahead of the first render
+    void warm(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal devicePixelRatio);
+
+    //* clear all tilesets
+    void clear()
+    {
+        _tileSets.clear();
+    }
+
+private:
+    //* cached tileset for given parameters, created if needed. Returns nullptr if frames cannot be rendered from cache
+    TileSet *tileSet(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal devicePixelRatio);
+
+    //* create tileset for given key
+    TileSet *createTileSet(qreal radius, const QColor &color, const QColor &outline, qreal penWidth, qreal devicePixelRatio) const;
+
+    //* tilesets
+    QCache<FrameTileKey, TileSet> _tileSets;
+};
+
+}
@@ -38,6 +38,7 @@
 #include <QPainter>
 #include <QStyleOption>
 #include <QWindow>
+#include <QtMath>
 
 namespace Breeze
 {
@@ -91,6 +92,11 @@ void Helper::loadConfig()
     _config->reparseConfiguration();
     _kwinConfig->reparseConfiguration();
     _cachedAutoValid = false;
+    _frameTileCache.clear();
+    _indicatorSpriteCache.clear();
+
+    // built from the frame radius, which is read again below
+    _menuFrameRegionTemplate = {};
     DecorationSettingsProvider::self()->reconfigure();
     _decorationConfig = DecorationSettingsProvider::self()->internalSettings();
 
@@ -541,7 +547,9 @@ void Helper::renderFrame(QPainter *painter, const QRectF &rect, const QColor &co
     }
 
     // render
-    painter->drawRoundedRect(frameRect, radius, radius);
+    if (!_frameTileCache.render(painter, rect, radius, color, outline, PenWidth::Frame)) {
+        painter->drawRoundedRect(frameRect, radius, radius);
+    }
 }
 
 //______________________________________________________________________________
@@ -627,7 +635,9 @@ void Helper::renderMenuFrame(QPainter *painter, const QRectF &rect, const QColor
         }
 
         // render
-        painter->drawRoundedRect(frameRect, radius, radius);
+        if (seamlessEdges != Qt::Edges() || !_frameTileCache.render(painter, rect, radius, color, outline, PenWidth::Frame)) {
+            painter->drawRoundedRect(frameRect, radius, radius);
+        }
 
     } else {
         painter->setRenderHint(QPainter::Antialiasing, false);
@@ -653,6 +663,19 @@ void Helper::renderMenuFrame(QPainter *painter, const QRectF &rect, const QColor
     painter->restore();
 }
 
+//______________________________________________________________________________
+void Helper::warmMenuFrame(const QColor &color, const QColor &outline, qreal devicePixelRatio) const
+{
+    // same radius as used for rounded corners in renderMenuFrame
+    qreal radius(frameRadius(PenWidth::NoPen));
+    if (outline.isValid()) {
+        radius = frameRadiusForNewPenWidth(radius, PenWidth::Frame);
+    }
+
+    _frameTileCache.warm(radius, color, outline, PenWidth::Frame, devicePixelRatio);
+}
+
+//______________________________________________________________________________
 QRegion Helper::menuFrameRegion(const QMenu *widget)
 {
     if (!widget) {
@@ -663,27 +686,92 @@ QRegion Helper::menuFrameRegion(const QMenu *widget)
     const auto seamlessEdges = menuSeamlessEdges(widget);
     const auto roundCorners = hasAlpha;
 
-    if (roundCorners) {
-        QRectF frameRect(widget->rect());
+    if (!roundCorners) {
+        return QRegion(widget->rect());
+    }
 
-        qreal radius(Metrics::Frame_FrameRadius+4);
+    const QRect rect(widget->rect());
+    const MenuFrameRegionTemplate &regionTemplate(menuFrameRegionTemplate());
+    if (rect.width() < regionTemplate.size || rect.height() < regionTemplate.size) {
+        return roundedMenuFrameRegion(rect, seamlessEdges);
+    }
 
-        frameRect.adjust( //
-            seamlessEdges.testFlag(Qt::LeftEdge) ? -radius : 0,
-            seamlessEdges.testFlag(Qt::TopEdge) ? -radius : 0,
-            seamlessEdges.testFlag(Qt::RightEdge) ? radius : 0,
-            seamlessEdges.testFlag(Qt::BottomEdge) ? radius : 0);
+    // cut the strips along non seamless edges, then the corners between two of them
+    const int dx(rect.width() - regionTemplate.size);
+    const int dy(rect.height() - regionTemplate.size);
+    const bool left(!seamlessEdges.testFlag(Qt::LeftEdge));
+    const bool top(!seamlessEdges.testFlag(Qt::TopEdge));
+    const bool right(!seamlessEdges.testFlag(Qt::RightEdge));
+    const bool bottom(!seamlessEdges.testFlag(Qt::BottomEdge));
 
-        // outline is always valid/drawn
-        frameRect = strokedRect(frameRect);
-        radius = frameRadiusForNewPenWidth(radius, PenWidth::Frame);
+    QRegion region(rect.adjusted(left ? regionTemplate.insets.left() : 0,
+                                 top ? regionTemplate.insets.top() : 0,
+                                 right ? -regionTemplate.insets.right() : 0,
+                                 bottom ? -regionTemplate.insets.bottom() : 0));
+    if (left && top) {
+        region -= regionTemplate.topLeft;
+    }
+    if (right && top) {
+        region -= regionTemplate.topRight.translated(dx, 0);
+    }
+    if (left && bottom) {
+        region -= regionTemplate.bottomLeft.translated(0, dy);
+    }
+    if (right && bottom) {
+        region -= regionTemplate.bottomRight.translated(dx, dy);
+    }
+
+    return region;
+}
 
-        QPainterPath path;
-        path.addRoundedRect(frameRect, radius, radius);
-        return QRegion(path.toFillPolygon().toPolygon()).intersected(widget->rect());
+//______________________________________________________________________________
+const Helper::MenuFrameRegionTemplate &Helper::menuFrameRegionTemplate() const
+{
+    if (_menuFrameRegionTemplate.size > 0) {
+        return _menuFrameRegionTemplate;
     }
 
-    return QRegion(widget->rect());
+    // large enough for each corner to fit in its own quadrant, with straight edges in between
+    const int half(qCeil(Metrics::Frame_FrameRadius + 4) + 2);
+    const QRect rect(0, 0, 2 * half, 2 * half);
+    const QRegion cut(QRegion(rect) - roundedMenuFrameRegion(rect, Qt::Edges()));
+
+    // straight edges are sampled across the middle of the rect
+    MenuFrameRegionTemplate &regionTemplate(_menuFrameRegionTemplate);
+    regionTemplate.insets = QMargins(cut.intersected(QRect(0, half, half, 1)).boundingRect().width(),
+                                     cut.intersected(QRect(half, 0, 1, half)).boundingRect().height(),
+                                     cut.intersected(QRect(half, half, half, 1)).boundingRect().width(),
+                                     cut.intersected(QRect(half, half, 1, half)).boundingRect().height());
+
+    regionTemplate.topLeft = cut.intersected(QRect(0, 0, half, half));
+    regionTemplate.topRight = cut.intersected(QRect(half, 0, half, half));
+    regionTemplate.bottomLeft = cut.intersected(QRect(0, half, half, half));
+    regionTemplate.bottomRight = cut.intersected(QRect(half, half, half, half));
+    regionTemplate.size = rect.width();
+
+    return regionTemplate;
+}
+
+//______________________________________________________________________________
+QRegion Helper::roundedMenuFrameRegion(const QRect &rect, Qt::Edges seamlessEdges) const
+{
+    QRectF frameRect(rect);
+
+    qreal radius(Metrics::Frame_FrameRadius + 4);
+
+    frameRect.adjust( //
+        seamlessEdges.testFlag(Qt::LeftEdge) ? -radius : 0,
+        seamlessEdges.testFlag(Qt::TopEdge) ? -radius : 0,
+        seamlessEdges.testFlag(Qt::RightEdge) ? radius : 0,
+        seamlessEdges.testFlag(Qt::BottomEdge) ? radius : 0);
+
+    // outline is always valid/drawn
+    frameRect = strokedRect(frameRect);
+    radius = frameRadiusForNewPenWidth(radius, PenWidth::Frame);
+
+    QPainterPath path;
+    path.addRoundedRect(frameRect, radius, radius);
+    return QRegion(path.toFillPolygon().toPolygon()).intersected(rect);
 }
 
 //______________________________________________________________________________
@@ -788,7 +876,13 @@ void Helper::renderButtonFrame(QPainter *painter,
     painter->setRenderHint(QPainter::Antialiasing, true);
     painter->setBrush(bgBrush);
     painter->setPen(QPen(penBrush, PenWidth::Frame));
-    painter->drawRoundedRect(frameRect, radius, radius);
+
+    // gradients cannot be stretched from a nine-patch
+    const bool solidBrushes(bgBrush.style() == Qt::SolidPattern && (penBrush.style() == Qt::SolidPattern || penBrush.style() == Qt::NoBrush));
+    const QColor outline(penBrush.style() == Qt::SolidPattern ? penBrush.color() : QColor(Qt::transparent));
+    if (!(solidBrushes && _frameTileCache.render(painter, shadowedRect, radius, bgBrush.color(), outline, PenWidth::Frame))) {
+        painter->drawRoundedRect(frameRect, radius, radius);
+    }
 }
 
 //______________________________________________________________________________
@@ -865,10 +959,9 @@ void Helper::renderTabWidgetFrame(QPainter *painter, const QRectF &rect, const Q
 //______________________________________________________________________________
 void Helper::renderSelection(QPainter *painter, const QRectF &rect, const QColor &color) const
 {
-    painter->setRenderHint(QPainter::Antialiasing);
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(color);
-    painter->drawRect(rect);
+    // selections are square, so that the cells of a selected row tile without seams.
+    // A plain fill skips the antialiased path rasterizer
+    painter->fillRect(rect, color);
 }
 
 //______________________________________________________________________________
@@ -1155,6 +1248,88 @@ void Helper::renderRadioButton(QPainter *painter,
     }
 }
 
+//______________________________________________________________________________
+static IndicatorSpriteKey indicatorSpriteKey(IndicatorSpriteKey::Type type,
+                                             int state,
+                                             const QPalette &palette,
+                                             bool mouseOver,
+                                             bool neutralHighlight,
+                                             bool sunken,
+                                             qreal hoverAnimation)
+{
+    IndicatorSpriteKey key;
+    key.type = type;
+    key.state = quint8(state);
+    key.mouseOver = mouseOver;
+    key.neutralHighlight = neutralHighlight;
+    key.sunken = sunken;
+    if (mouseOver) {
+        const qreal hover(hoverAnimation == AnimationData::OpacityInvalid ? 1.0 : qBound(0.0, hoverAnimation, 1.0));
+        key.hover = quint8(qRound(hover * IndicatorSpriteCache::hoverSteps));
+    }
+    key.colorGroup = quint8(palette.currentColorGroup());
+    key.highlight = palette.color(QPalette::Highlight).rgba();
+    key.button = palette.color(QPalette::Button).rgba();
+    key.text = palette.color(QPalette::Text).rgba();
+    key.window = palette.color(QPalette::Window).rgba();
+    key.windowText = palette.color(QPalette::WindowText).rgba();
+    return key;
+}
+
+//______________________________________________________________________________
+void Helper::renderCheckBoxIndicator(QPainter *painter,
+                                     const QRectF &rect,
+                                     const QPalette &palette,
+                                     bool mouseOver,
+                                     CheckBoxState state,
+                                     CheckBoxState target,
+                                     bool neutalHighlight,
+                                     bool sunken,
+                                     qreal animation,
+                                     qreal hoverAnimation) const
+{
+    // the dash animated check mark is only painted live while the check animation runs
+    if (state != CheckAnimated && palette.text().style() == Qt::SolidPattern) {
+        const auto key(indicatorSpriteKey(IndicatorSpriteKey::CheckBox, state, palette, mouseOver, neutalHighlight, sunken, hoverAnimation));
+        const qreal hover(qreal(key.hover) / IndicatorSpriteCache::hoverSteps);
+        if (_indicatorSpriteCache.render(painter, rect, key, [&](QPainter *spritePainter, const QRectF &spriteRect) {
+                renderCheckBoxBackground(spritePainter, spriteRect, palette, state, neutalHighlight, sunken, animation);
+                renderCheckBox(spritePainter, spriteRect, palette, mouseOver, state, target, neutalHighlight, sunken, animation, hover);
+            })) {
+            return;
+        }
+    }
+
+    renderCheckBoxBackground(painter, rect, palette, state, neutalHighlight, sunken, animation);
+    renderCheckBox(painter, rect, palette, mouseOver, state, target, neutalHighlight, sunken, animation, hoverAnimation);
+}
+
+//______________________________________________________________________________
+void Helper::renderRadioButtonIndicator(QPainter *painter,
+                                        const QRectF &rect,
+                                        const QPalette &palette,
+                                        bool mouseOver,
+                                        RadioButtonState state,
+                                        bool neutalHighlight,
+                                        bool sunken,
+                                        qreal animation,
+                                        qreal hoverAnimation) const
+{
+    if (state != RadioAnimated && palette.text().style() == Qt::SolidPattern) {
+        const auto key(indicatorSpriteKey(IndicatorSpriteKey::RadioButton, state, palette, mouseOver, neutalHighlight, sunken, hoverAnimation));
+        const qreal hover(qreal(key.hover) / IndicatorSpriteCache::hoverSteps);
+        if (_indicatorSpriteCache.render(painter, rect, key, [&](QPainter *spritePainter, const QRectF &spriteRect) {
+                renderRadioButtonBackground(spritePainter, spriteRect, palette, state, neutalHighlight, sunken, animation);
+                renderRadioButton(spritePainter, spriteRect, palette, mouseOver, state, neutalHighlight, sunken, animation, hover);
+            })) {
+            return;
+        }
+    }
+
+    renderRadioButtonBackground(painter, rect, palette, state, neutalHighlight, sunken, animation);
+    renderRadioButton(painter, rect, palette, mouseOver, state, neutalHighlight, sunken, animation, hoverAnimation);
+}
+
 //______________________________________________________________________________
 void Helper::renderSliderGroove(QPainter *painter, const QRectF &rect, const QColor &fg, const QColor &bg) const
 {
@@ -8,6 +8,8 @@
 
 #include "breeze.h"
 #include "breezeanimationdata.h"
+#include "breezeframetilecache.h"
+#include "breezeindicatorspritecache.h"
 #include "breezemetrics.h"
 #include "breezesettings.h"
 #include "breezestyle.h"
@@ -223,6 +225,15 @@ public:
 
     QRegion menuFrameRegion(const QMenu *widget);
 
+    //* create the menu frame tileset for given colors and device pixel ratio, ahead of the first menu shown
+    void warmMenuFrame(const QColor &color, const QColor &outline, qreal devicePixelRatio) const;
+
+    //* create the template used to build rounded menu blur regions, ahead of the first menu shown
+    void warmMenuFrameRegion() const
+    {
+        menuFrameRegionTemplate();
+    }
+
     //* button frame
     void renderButtonFrame(QPainter *painter,
                            const QRectF &rect,
@@ -284,6 +295,29 @@ public:
                            qreal animation = AnimationData::OpacityInvalid,
                            qreal hoverAnimation = AnimationData::OpacityInvalid) const;
 
+    //* checkbox background and mark, blitted from the sprite cache unless the check animation is running
+    void renderCheckBoxIndicator(QPainter *,
+                                 const QRectF &,
+                                 const QPalette &palette,
+                                 bool mouseOver,
+                                 CheckBoxState state,
+                                 CheckBoxState target,
+                                 bool neutalHighlight,
+                                 bool sunken,
+                                 qreal animation = AnimationData::OpacityInvalid,
+                                 qreal hoverAnimation = AnimationData::OpacityInvalid) const;
+
+    //* radio button background and mark, blitted from the sprite cache unless the check animation is running
+    void renderRadioButtonIndicator(QPainter *,
+                                    const QRectF &,
+                                    const QPalette &palette,
+                                    bool mouseOver,
+                                    RadioButtonState state,
+                                    bool neutalHighlight,
+                                    bool sunken,
+                                    qreal animation = AnimationData::OpacityInvalid,
+                                    qreal hoverAnimation = AnimationData::OpacityInvalid) const;
+
     //* slider groove
     void renderSliderGroove(QPainter *, const QRectF &, const QColor &fg, const QColor &bg) const;
 
@@ -411,7 +445,32 @@ protected:
     //* return rounded path in a given rect, with only selected corners rounded, and for a given radius
     QPainterPath roundedPath(const QRectF &, Corners, qreal) const;
 
+    //* rounded menu frame region for a given rect, computed from a painter path
+    QRegion roundedMenuFrameRegion(const QRect &, Qt::Edges seamlessEdges) const;
+
 private:
+    //* what the rounded menu frame cuts out of a menu rect
+    /**
+    rounded menu frames only differ by the position of their corners, so the region
+    is computed once for a small rect, and reused to build the region of any menu
+    */
+    struct MenuFrameRegionTemplate {
+        //* size of the square rect the template was computed for
+        int size = 0;
+
+        //* width of the strips cut along each edge
+        QMargins insets;
+
+        //* parts cut in each corner, relative to the template rect
+        QRegion topLeft;
+        QRegion topRight;
+        QRegion bottomLeft;
+        QRegion bottomRight;
+    };
+
+    //* menu frame region template, computed if needed
+    const MenuFrameRegionTemplate &menuFrameRegionTemplate() const;
+
     //* configuration
     KSharedConfig::Ptr _config;
 
@@ -444,6 +503,15 @@ private:
 
     mutable bool _cachedAutoValid = false;
 
+    //* nine-patch cache for rounded frames
+    mutable FrameTileCache _frameTileCache;
+
+    //* sprite cache for check box and radio button indicators
+    mutable IndicatorSpriteCache _indicatorSpriteCache;
+
+    //* rounded menu frame region template
+    mutable MenuFrameRegionTemplate _menuFrameRegionTemplate;
+
     friend class ToolsAreaManager;
 };
 
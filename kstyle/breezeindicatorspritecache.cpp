@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezeindicatorspritecache.h"
+
+#include <array>
+
+namespace Breeze
+{
+
+//______________________________________________________________
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const IndicatorSpriteKey &key, size_t seed)
+#else
+uint qHash(const IndicatorSpriteKey &key, uint seed)
+#endif
+{
+    const std::array<quint32, 9> data = {quint32(key.type) | (quint32(key.state) << 8) | (quint32(key.hover) << 16) | (quint32(key.colorGroup) << 24),
+                                         quint32(key.mouseOver) | (quint32(key.neutralHighlight) << 1) | (quint32(key.sunken) << 2),
+                                         key.highlight,
+                                         key.button,
+                                         key.text,
+                                         key.window,
+                                         key.windowText,
+                                         quint32(key.width) | (quint32(key.height) << 16),
+                                         quint32(key.devicePixelRatio)};
+    return qHashBits(data.data(), sizeof(data), seed);
+}
+
+//______________________________________________________________
+IndicatorSpriteCache::IndicatorSpriteCache(int maxCost)
+    : _sprites(maxCost)
+{
+}
+
+}
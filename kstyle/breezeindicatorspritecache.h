@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "breezepixelalignment.h"
+
+#include <QCache>
+#include <QPainter>
+#include <QPixmap>
+#include <QRectF>
+#include <QRgb>
+
+namespace Breeze
+{
+
+//* key identifying a check box or radio button indicator sprite
+struct IndicatorSpriteKey {
+    enum Type : quint8 { CheckBox, RadioButton };
+
+    Type type = CheckBox;
+
+    //* CheckBoxState or RadioButtonState
+    quint8 state = 0;
+
+    bool mouseOver = false;
+    bool neutralHighlight = false;
+    bool sunken = false;
+
+    //* hover opacity, quantized to IndicatorSpriteCache::hoverSteps
+    quint8 hover = 0;
+
+    //* palette color group, which also selects the color scheme focus and neutral colors
+    quint8 colorGroup = 0;
+
+    //* palette colors the indicators are painted with
+    QRgb highlight = 0;
+    QRgb button = 0;
+    QRgb text = 0;
+    QRgb window = 0;
+    QRgb windowText = 0;
+
+    //* size, in pixels, and device pixel ratio, in 1/64th. Set by IndicatorSpriteCache::render
+    int width = 0;
+    int height = 0;
+    int devicePixelRatio = 0;
+
+    bool operator==(const IndicatorSpriteKey &other) const
+    {
+        return type == other.type && state == other.state && mouseOver == other.mouseOver && neutralHighlight == other.neutralHighlight
+            && sunken == other.sunken && hover == other.hover && colorGroup == other.colorGroup && highlight == other.highlight
+            && button == other.button && text == other.text && window == other.window && windowText == other.windowText && width == other.width
+            && height == other.height && devicePixelRatio == other.devicePixelRatio;
+    }
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const IndicatorSpriteKey &, size_t seed = 0);
+#else
+uint qHash(const IndicatorSpriteKey &, uint seed = 0);
+#endif
+
+//* LRU cache of check box and radio button indicator sprites
+/**
+indicators in a resting state, or with a hover fade in progress, are painted once per
+state, colors, size and device pixel ratio into a pixmap, then blitted.
+Painters and rects rejected by PixelAlignment::acceptsBlit are left to the caller to paint directly.
+*/
+class IndicatorSpriteCache
+{
+public:
+    //* number of distinct hover opacities
+    static constexpr int hoverSteps = 32;
+
+    //* constructor, with the total size of the sprites kept, in kilobytes
+    explicit IndicatorSpriteCache(int maxCost = 1024);
+
+    //* render sprite matching key in rect
+    /**
+    paintSprite(QPainter *, const QRectF &) is called to paint the sprite content on a
+    transparent pixmap the size of rect, if it is not cached yet.
+    Returns false if the sprite could not be rendered from cache.
+    */
+    template<typename PaintFunction>
+    bool render(QPainter *painter, const QRectF &rect, IndicatorSpriteKey key, PaintFunction paintSprite)
+    {
+        qreal devicePixelRatio;
+        if (!PixelAlignment::acceptsBlit(painter, rect, devicePixelRatio)) {
+            return false;
+        }
+
+        key.width = int(rect.width());
+        key.height = int(rect.height());
+        key.devicePixelRatio = qRound(devicePixelRatio * 64);
+
+        if (const QPixmap *sprite = _sprites.object(key)) {
+            painter->drawPixmap(rect.topLeft(), *sprite);
+            return true;
+        }
+
+        auto sprite = new QPixmap(rect.size().toSize() * devicePixelRatio);
+        sprite->setDevicePixelRatio(devicePixelRatio);
+        sprite->fill(Qt::transparent);
+
+        QPainter spritePainter(sprite);
+        paintSprite(&spritePainter, QRectF(QPointF(0, 0), rect.size()));
+        spritePainter.end();
+
+        // draw before inserting, since the cache may delete sprites exceeding its maximum cost
+        painter->drawPixmap(rect.topLeft(), *sprite);
+        _sprites.insert(key, sprite, qMax(1, int(sprite->width() * sprite->height() * 4 / 1024)));
+        return true;
+    }
+
+    //* clear all sprites
+    void clear()
+    {
+        _sprites.clear();
+    }
+
+private:
+    //* sprites
+    QCache<IndicatorSpriteKey, QPixmap> _sprites;
+};
+
+}
@@ -17,6 +17,8 @@
 #include <QPainter>
 #include <QTextStream>
 
+#include <utility>
+
 namespace Breeze
 {
 
@@ -173,7 +175,7 @@ bool MdiWindowShadowFactory::eventFilter(QObject *object, QEvent *event)
     // TODO: possibly implement ZOrderChange event, to make sure that
     // the shadow is always painted on top
     case QEvent::ZOrderChange:
-        updateShadowZOrder(object);
+        scheduleUpdate(object, false, true);
         break;
 
     case QEvent::Hide:
@@ -182,13 +184,13 @@ bool MdiWindowShadowFactory::eventFilter(QObject *object, QEvent *event)
 
     case QEvent::Show:
         installShadow(object);
-        updateShadowGeometry(object);
-        updateShadowZOrder(object);
+        scheduleUpdate(object, true, true);
         break;
 
+    // moving or resizing a subwindow sends several events per frame. Only the last geometry matters
     case QEvent::Move:
     case QEvent::Resize:
-        updateShadowGeometry(object);
+        scheduleUpdate(object, true, false);
         break;
 
     default:
@@ -201,22 +203,45 @@ bool MdiWindowShadowFactory::eventFilter(QObject *object, QEvent *event)
 //____________________________________________________________________________________
 MdiWindowShadow *MdiWindowShadowFactory::findShadow(QObject *object) const
 {
-    // check object,
-    if (!object->parent()) {
-        return nullptr;
+    // shadows are children of the MDI area, and may have been deleted with it
+    return _shadows.value(object).data();
+}
+
+//____________________________________________________________________________________
+void MdiWindowShadowFactory::scheduleUpdate(QObject *object, bool geometry, bool zOrder)
+{
+    PendingUpdate &update(_pendingUpdates[object]);
+    update.geometry |= geometry;
+    update.zOrder |= zOrder;
+
+    if (_updatesQueued) {
+        return;
     }
 
-    // find existing window shadows
-    const auto children = object->parent()->children();
-    for (QObject *child : children) {
-        if (MdiWindowShadow *shadow = qobject_cast<MdiWindowShadow *>(child)) {
-            if (shadow->widget() == object) {
-                return shadow;
-            }
+    _updatesQueued = true;
+    QMetaObject::invokeMethod(this, &MdiWindowShadowFactory::updateShadows, Qt::QueuedConnection);
+}
+
+//____________________________________________________________________________________
+void MdiWindowShadowFactory::updateShadows()
+{
+    _updatesQueued = false;
+
+    const auto pendingUpdates = std::exchange(_pendingUpdates, {});
+    for (auto it = pendingUpdates.constBegin(); it != pendingUpdates.constEnd(); ++it) {
+        // hidden subwindows are updated when shown again
+        if (!static_cast<QWidget *>(it.key())->isVisible()) {
+            continue;
         }
-    }
 
-    return nullptr;
+        if (it->geometry) {
+            updateShadowGeometry(it.key());
+        }
+
+        if (it->zOrder) {
+            updateShadowZOrder(it.key());
+        }
+    }
 }
 
 //____________________________________________________________________________________
@@ -240,12 +265,14 @@ void MdiWindowShadowFactory::installShadow(QObject *object)
     // create new shadow
     auto windowShadow(new MdiWindowShadow(widget->parentWidget(), _shadowHelper->shadowTiles(widget), _shadowHelper));
     windowShadow->setWidget(widget);
+    _shadows.insert(object, windowShadow);
 }
 
 //____________________________________________________________________________________
 void MdiWindowShadowFactory::removeShadow(QObject *object)
 {
-    if (MdiWindowShadow *windowShadow = findShadow(object)) {
+    _pendingUpdates.remove(object);
+    if (MdiWindowShadow *windowShadow = _shadows.take(object).data()) {
         windowShadow->hide();
         windowShadow->deleteLater();
     }
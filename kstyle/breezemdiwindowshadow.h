@@ -7,6 +7,7 @@
 #pragma once
 
 #include <QEvent>
+#include <QHash>
 #include <QObject>
 #include <QSet>
 
@@ -126,6 +127,9 @@ protected:
         }
     }
 
+    //* schedule geometry and/or ZOrder update for the next deferred pass
+    void scheduleUpdate(QObject *, bool geometry, bool zOrder);
+
     //* update shadows geometry
     void updateShadowGeometry(QObject *object) const
     {
@@ -147,10 +151,28 @@ protected Q_SLOTS:
     //* triggered by object destruction
     void widgetDestroyed(QObject *);
 
+    //* apply scheduled geometry and ZOrder updates
+    void updateShadows();
+
 private:
     //* set of registered widgets
     QSet<const QObject *> _registeredWidgets;
 
+    //* shadows, indexed by their subwindow
+    QHash<const QObject *, QPointer<MdiWindowShadow>> _shadows;
+
+    //* scheduled update, for a given subwindow
+    struct PendingUpdate {
+        bool geometry = false;
+        bool zOrder = false;
+    };
+
+    //* subwindows waiting for the next deferred pass
+    QHash<QObject *, PendingUpdate> _pendingUpdates;
+
+    //* true if a deferred pass is queued
+    bool _updatesQueued = false;
+
     //* shadow helper used to generate the shadows
     QPointer<ShadowHelper> _shadowHelper;
 };
@@ -6,7 +6,15 @@
 
 #include "breezemnemonics.h"
 
+#include <QAbstractButton>
+#include <QDockWidget>
+#include <QGroupBox>
 #include <QKeyEvent>
+#include <QKeySequence>
+#include <QLabel>
+#include <QMenu>
+#include <QMenuBar>
+#include <QTabBar>
 #include <QWidget>
 
 namespace Breeze
@@ -39,24 +47,58 @@ void Mnemonics::setMode(int mode)
     }
 }
 
+//____________________________________________________
+bool Mnemonics::registerWidget(QWidget *widget)
+{
+    if (!widget || _registeredWidgets.contains(widget)) {
+        return false;
+    }
+
+    // only widgets which draw their text through the style with mnemonic flags
+    if (!(qobject_cast<QAbstractButton *>(widget) || qobject_cast<QLabel *>(widget) || qobject_cast<QGroupBox *>(widget) || qobject_cast<QTabBar *>(widget)
+          || qobject_cast<QMenuBar *>(widget) || qobject_cast<QMenu *>(widget) || qobject_cast<QDockWidget *>(widget))) {
+        return false;
+    }
+
+    _registeredWidgets.insert(widget);
+    connect(widget, &QObject::destroyed, this, &Mnemonics::widgetDestroyed);
+    return true;
+}
+
+//____________________________________________________
+void Mnemonics::unregisterWidget(QWidget *widget)
+{
+    if (!widget || !_registeredWidgets.remove(widget)) {
+        return;
+    }
+
+    disconnect(widget, &QObject::destroyed, this, &Mnemonics::widgetDestroyed);
+}
+
+//____________________________________________________
+void Mnemonics::widgetDestroyed(QObject *object)
+{
+    _registeredWidgets.remove(object);
+}
+
 //____________________________________________________
 bool Mnemonics::eventFilter(QObject *, QEvent *event)
 {
     switch (event->type()) {
     case QEvent::KeyPress:
         if (static_cast<QKeyEvent *>(event)->key() == Qt::Key_Alt) {
-            setEnabled(true);
+            setEnabledInActiveWindows(true);
         }
         break;
 
     case QEvent::KeyRelease:
         if (static_cast<QKeyEvent *>(event)->key() == Qt::Key_Alt) {
-            setEnabled(false);
+            setEnabledInActiveWindows(false);
         }
         break;
 
     case QEvent::ApplicationStateChange:
-        setEnabled(false);
+        setEnabledInActiveWindows(false);
         break;
 
     default:
@@ -82,4 +124,103 @@ void Mnemonics::setEnabled(bool value)
     }
 }
 
+//____________________________________________________
+void Mnemonics::setEnabledInActiveWindows(bool value)
+{
+    if (_enabled == value) {
+        return;
+    }
+
+    _enabled = value;
+
+    // windows to repaint: the ones mnemonics were last toggled in, plus the currently active ones
+    QSet<const QWidget *> windows;
+    for (const auto &window : std::as_const(_windows)) {
+        if (window) {
+            windows.insert(window);
+        }
+    }
+
+    _windows.clear();
+    for (QWidget *window : {qApp->activeWindow(), qApp->activePopupWidget()}) {
+        if (window) {
+            windows.insert(window);
+            _windows.append(window);
+        }
+    }
+
+    if (windows.isEmpty()) {
+        return;
+    }
+
+    // only repaint the text of registered widgets that actually hold a mnemonic
+    for (const QObject *object : std::as_const(_registeredWidgets)) {
+        auto widget = static_cast<QWidget *>(const_cast<QObject *>(object));
+        if (!widget->isVisible() || !windows.contains(widget->window())) {
+            continue;
+        }
+
+        const QRegion region(mnemonicRegion(widget));
+        if (!region.isEmpty()) {
+            widget->update(region);
+        }
+    }
+}
+
+//____________________________________________________
+QRegion Mnemonics::mnemonicRegion(QWidget *widget) const
+{
+    auto hasMnemonic = [](const QString &text) {
+        return !QKeySequence::mnemonic(text).isEmpty();
+    };
+
+    QRegion region;
+    if (auto button = qobject_cast<QAbstractButton *>(widget)) {
+        if (hasMnemonic(button->text())) {
+            region = button->rect();
+        }
+
+    } else if (auto label = qobject_cast<QLabel *>(widget)) {
+        // labels only show mnemonics when they have a buddy
+        if (label->buddy() && hasMnemonic(label->text())) {
+            region = label->contentsRect();
+        }
+
+    } else if (auto groupBox = qobject_cast<QGroupBox *>(widget)) {
+        if (hasMnemonic(groupBox->title())) {
+            region = groupBox->rect();
+        }
+
+    } else if (auto dockWidget = qobject_cast<QDockWidget *>(widget)) {
+        if (hasMnemonic(dockWidget->windowTitle())) {
+            region = dockWidget->rect();
+        }
+
+    } else if (auto tabBar = qobject_cast<QTabBar *>(widget)) {
+        for (int i = 0; i < tabBar->count(); ++i) {
+            if (hasMnemonic(tabBar->tabText(i))) {
+                region += tabBar->tabRect(i);
+            }
+        }
+
+    } else if (auto menuBar = qobject_cast<QMenuBar *>(widget)) {
+        const auto actions = menuBar->actions();
+        for (QAction *action : actions) {
+            if (action->isVisible() && hasMnemonic(action->text())) {
+                region += menuBar->actionGeometry(action);
+            }
+        }
+
+    } else if (auto menu = qobject_cast<QMenu *>(widget)) {
+        const auto actions = menu->actions();
+        for (QAction *action : actions) {
+            if (action->isVisible() && hasMnemonic(action->text())) {
+                region += menu->actionGeometry(action);
+            }
+        }
+    }
+
+    return region;
+}
+
 }
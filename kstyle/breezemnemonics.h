@@ -9,6 +9,10 @@
 #include <QApplication>
 #include <QEvent>
 #include <QObject>
+#include <QPointer>
+#include <QRegion>
+#include <QSet>
+#include <QVector>
 
 #include "breezestyleconfigdata.h"
 
@@ -26,6 +30,12 @@ public:
     //* set mode
     void setMode(int);
 
+    //* register widget that may display mnemonics
+    bool registerWidget(QWidget *);
+
+    //* unregister widget
+    void unregisterWidget(QWidget *);
+
     //* event filter
     bool eventFilter(QObject *, QEvent *) override;
 
@@ -42,12 +52,29 @@ public:
     }
 
 protected:
-    //* set enable state
+    //* set enable state, repainting all top level widgets
     void setEnabled(bool);
 
+    //* set enable state, repainting only the mnemonics of registered widgets in the active windows
+    void setEnabledInActiveWindows(bool);
+
+    //* region of the given widget in which mnemonics are drawn
+    QRegion mnemonicRegion(QWidget *) const;
+
+protected Q_SLOTS:
+
+    //* triggered by object destruction
+    void widgetDestroyed(QObject *);
+
 private:
     //* enable state
     bool _enabled = true;
+
+    //* widgets that may display mnemonics
+    QSet<const QObject *> _registeredWidgets;
+
+    //* windows repainted when mnemonics were last toggled, so that they are repainted again when toggled back
+    QVector<QPointer<QWidget>> _windows;
 };
 
 }
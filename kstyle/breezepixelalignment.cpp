@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezepixelalignment.h"
+
+namespace Breeze
+{
+
+namespace PixelAlignment
+{
+
+//______________________________________________________________
+bool isIntegerDevicePixelRatio(qreal devicePixelRatio)
+{
+    return devicePixelRatio == qRound(devicePixelRatio);
+}
+
+//______________________________________________________________
+bool acceptsBlit(QPainter *painter, const QRectF &rect, qreal &devicePixelRatio)
+{
+    // blits would also overwrite the transparent pixels with other composition modes
+    if (painter->compositionMode() != QPainter::CompositionMode_SourceOver) {
+        return false;
+    }
+
+    if (rect.isEmpty() || QRectF(rect.toRect()) != rect) {
+        return false;
+    }
+
+    const QTransform &transform(painter->worldTransform());
+    if (transform.type() > QTransform::TxTranslate || transform.dx() != qRound(transform.dx()) || transform.dy() != qRound(transform.dy())) {
+        return false;
+    }
+
+    devicePixelRatio = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    return isIntegerDevicePixelRatio(devicePixelRatio);
+}
+
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QPainter>
+#include <QRectF>
+
+namespace Breeze
+{
+
+//* checks shared by the pixmap caches, which blit pre-rendered pixmaps in place of painting
+namespace PixelAlignment
+{
+//* true if pixmaps rendered at the given device pixel ratio fall on device pixels
+bool isIntegerDevicePixelRatio(qreal devicePixelRatio);
+
+//* true if a pixmap blitted with this painter in rect gives the same pixels as painting directly
+/** devicePixelRatio is set to the one of the painter device */
+bool acceptsBlit(QPainter *, const QRectF &rect, qreal &devicePixelRatio);
+}
+
+}
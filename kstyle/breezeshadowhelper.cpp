@@ -22,6 +22,7 @@
 #include <QPainter>
 #include <QPixmap>
 #include <QPlatformSurfaceEvent>
+#include <QScreen>
 #include <QTextStream>
 #include <QToolBar>
 
@@ -72,6 +73,9 @@ ShadowHelper::ShadowHelper(const std::shared_ptr<Helper> &helper)
     , _helper(helper)
 {
     Q_ASSERT(helper);
+
+    // render shadow tiles for new screens ahead of the first menu shown on them
+    connect(qApp, &QGuiApplication::screenAdded, this, &ShadowHelper::scheduleWarmShadowTiles);
 }
 
 //_______________________________________________________
@@ -83,8 +87,7 @@ ShadowHelper::~ShadowHelper()
 //______________________________________________
 void ShadowHelper::reset()
 {
-    _tiles.clear();
-    _shadowTiles = TileSet();
+    _shadowTiles.clear();
 }
 
 //_______________________________________________________
@@ -104,6 +107,9 @@ bool ShadowHelper::registerWidget(QWidget *widget, bool force)
     installShadows(widget);
     _widgets.insert(widget);
 
+    // prepare shadow tiles for the other screens
+    scheduleWarmShadowTiles();
+
     // install event filter
     widget->removeEventFilter(this);
     widget->installEventFilter(this);
@@ -139,6 +145,9 @@ void ShadowHelper::loadConfig()
     for (QWidget *widget : _widgets) {
         installShadows(widget);
     }
+
+    // prepare shadow tiles for the other screens
+    scheduleWarmShadowTiles();
 }
 
 //_______________________________________________________
@@ -179,16 +188,24 @@ bool ShadowHelper::eventFilter(QObject *object, QEvent *event)
 
 //_______________________________________________________
 TileSet ShadowHelper::shadowTiles(QWidget *widget)
+{
+    return shadowTiles(devicePixelRatio(widget));
+}
+
+//_______________________________________________________
+TileSet ShadowHelper::shadowTiles(qreal dpr)
 {
     CompositeShadowParams params = lookupShadowParams(_helper->decorationConfig()->shadowSize());
 
     if (params.isNone()) {
         return TileSet();
-    } else if (_shadowTiles.isValid()) {
-        return _shadowTiles;
     }
 
-    const qreal dpr = devicePixelRatio(widget);
+    ShadowTiles &cachedTiles(_shadowTiles[dpr]);
+    if (cachedTiles.tileSet.isValid()) {
+        return cachedTiles.tileSet;
+    }
+
     params *= dpr;
 
     auto withOpacity = [](const QColor &color, qreal opacity) -> QColor {
@@ -237,9 +254,9 @@ TileSet ShadowHelper::shadowTiles(QWidget *widget)
     painter.end();
 
     const QPoint innerRectTopLeft = outerRect.center();
-    _shadowTiles = TileSet(QPixmap::fromImage(std::move(shadowTexture)), innerRectTopLeft.x(), innerRectTopLeft.y(), 1, 1);
+    cachedTiles.tileSet = TileSet(QPixmap::fromImage(std::move(shadowTexture)), innerRectTopLeft.x(), innerRectTopLeft.y(), 1, 1);
 
-    return _shadowTiles;
+    return cachedTiles.tileSet;
 }
 
 //_______________________________________________________
@@ -256,6 +273,38 @@ void ShadowHelper::windowDeleted(QObject *object)
     _shadows.remove(window);
 }
 
+//_______________________________________________________
+void ShadowHelper::scheduleWarmShadowTiles()
+{
+    // nothing to prepare for until a shadow is actually needed
+    if (_warmQueued || _widgets.isEmpty()) {
+        return;
+    }
+
+    _warmQueued = true;
+    QMetaObject::invokeMethod(this, &ShadowHelper::warmShadowTiles, Qt::QueuedConnection);
+}
+
+//_______________________________________________________
+void ShadowHelper::warmShadowTiles()
+{
+    _warmQueued = false;
+
+    // on Wayland a single set of tiles is shared by all screens
+    if (Helper::isWayland()) {
+        shadowTiles(qreal(1));
+        createShadowTiles(1);
+        return;
+    }
+
+    const auto screens = QGuiApplication::screens();
+    for (QScreen *screen : screens) {
+        const qreal dpr(screen->devicePixelRatio());
+        shadowTiles(dpr);
+        createShadowTiles(dpr);
+    }
+}
+
 //_______________________________________________________
 bool ShadowHelper::isMenu(QWidget *widget) const
 {
@@ -316,22 +365,25 @@ bool ShadowHelper::acceptWidget(QWidget *widget) const
 }
 
 //______________________________________________
-const QVector<KWindowShadowTile::Ptr> &ShadowHelper::createShadowTiles()
+const QVector<KWindowShadowTile::Ptr> &ShadowHelper::createShadowTiles(qreal dpr)
 {
+    ShadowTiles &cachedTiles(_shadowTiles[dpr]);
+
     // make sure size is valid
-    if (_tiles.isEmpty()) {
-        _tiles = {createTile(_shadowTiles.pixmap(1)),
-                  createTile(_shadowTiles.pixmap(2)),
-                  createTile(_shadowTiles.pixmap(5)),
-                  createTile(_shadowTiles.pixmap(8)),
-                  createTile(_shadowTiles.pixmap(7)),
-                  createTile(_shadowTiles.pixmap(6)),
-                  createTile(_shadowTiles.pixmap(3)),
-                  createTile(_shadowTiles.pixmap(0))};
+    if (cachedTiles.tiles.isEmpty() && cachedTiles.tileSet.isValid()) {
+        const TileSet &tileSet(cachedTiles.tileSet);
+        cachedTiles.tiles = {createTile(tileSet.pixmap(1)),
+                             createTile(tileSet.pixmap(2)),
+                             createTile(tileSet.pixmap(5)),
+                             createTile(tileSet.pixmap(8)),
+                             createTile(tileSet.pixmap(7)),
+                             createTile(tileSet.pixmap(6)),
+                             createTile(tileSet.pixmap(3)),
+                             createTile(tileSet.pixmap(0))};
     }
 
     // return relevant list of shadow tiles
-    return _tiles;
+    return cachedTiles.tiles;
 }
 
 //______________________________________________
@@ -359,14 +411,14 @@ void ShadowHelper::installShadows(QWidget *widget)
         return;
     }
 
-    // create shadow tiles if needed
-    shadowTiles(widget);
-    if (!_shadowTiles.isValid()) {
+    // create shadow tiles for the widget's device pixel ratio if needed
+    const qreal dpr = devicePixelRatio(widget);
+    if (!shadowTiles(dpr).isValid()) {
         return;
     }
 
-    // create platform shadow tiles if needed
-    const QVector<KWindowShadowTile::Ptr> &tiles = createShadowTiles();
+    // create platform shadow tiles if needed, shared by all windows with the same device pixel ratio
+    const QVector<KWindowShadowTile::Ptr> &tiles = createShadowTiles(dpr);
     if (tiles.count() != numTiles) {
         return;
     }
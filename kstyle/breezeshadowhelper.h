@@ -12,6 +12,7 @@
 
 #include <KWindowShadow>
 
+#include <QHash>
 #include <QMap>
 #include <QMargins>
 #include <QObject>
@@ -111,6 +112,14 @@ public:
         return _helper;
     }
 
+    //* schedule rendering of shadow tiles for all connected screens. Does nothing until a widget with a shadow is registered
+    void scheduleWarmShadowTiles();
+
+public Q_SLOTS:
+
+    //* render shadow tiles for the device pixel ratio of every connected screen
+    void warmShadowTiles();
+
 protected Q_SLOTS:
 
     //* unregister widget
@@ -135,8 +144,11 @@ protected:
     //* accept widget
     bool acceptWidget(QWidget *) const;
 
-    // create shared shadow tiles from tileset
-    const QVector<KWindowShadowTile::Ptr> &createShadowTiles();
+    //* shadow tiles for a given device pixel ratio
+    TileSet shadowTiles(qreal devicePixelRatio);
+
+    // create shared shadow tiles from tileset for a given device pixel ratio
+    const QVector<KWindowShadowTile::Ptr> &createShadowTiles(qreal devicePixelRatio);
 
     // create shadow tile from pixmap
     KWindowShadowTile::Ptr createTile(const QPixmap &);
@@ -160,16 +172,26 @@ private:
     //* managed shadows
     QMap<QWindow *, KWindowShadow *> _shadows;
 
-    //* tileset
-    TileSet _shadowTiles;
-
     //* number of tiles
     enum {
         numTiles = 8
     };
 
-    //* shared shadow tiles
-    QVector<KWindowShadowTile::Ptr> _tiles;
+    //* shadow tiles rendered for a given device pixel ratio
+    struct ShadowTiles {
+        //* tileset
+        TileSet tileSet;
+
+        //* shared shadow tiles
+        QVector<KWindowShadowTile::Ptr> tiles;
+    };
+
+    //* shadow tiles, keyed by device pixel ratio
+    /** all other shadow parameters come from the configuration, so the cache is cleared on reset */
+    QHash<qreal, ShadowTiles> _shadowTiles;
+
+    //* true if warmShadowTiles is already queued
+    bool _warmQueued = false;
 };
 
 }
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezeshowlatencytracker.h"
+
+#include "breeze_logging.h"
+
+#include <QMenu>
+#include <QPlatformSurfaceEvent>
+#include <QPointer>
+
+namespace Breeze
+{
+
+//____________________________________________________________________
+ShowLatencyTracker::ShowLatencyTracker()
+    : QObject()
+{
+}
+
+//____________________________________________________________________
+bool ShowLatencyTracker::isEnabled()
+{
+    return HELIUM().isDebugEnabled();
+}
+
+//____________________________________________________________________
+void ShowLatencyTracker::registerWidget(QWidget *widget)
+{
+    if (!widget || !isEnabled() || _widgets.contains(widget)) {
+        return;
+    }
+
+    if (!(qobject_cast<QMenu *>(widget) || widget->inherits("QTipLabel"))) {
+        return;
+    }
+
+    _widgets.insert(widget, QElapsedTimer());
+
+    widget->removeEventFilter(this);
+    widget->installEventFilter(this);
+    connect(widget, &QObject::destroyed, this, &ShowLatencyTracker::widgetDestroyed);
+}
+
+//____________________________________________________________________
+void ShowLatencyTracker::unregisterWidget(QWidget *widget)
+{
+    if (!widget || !_widgets.remove(widget)) {
+        return;
+    }
+
+    widget->removeEventFilter(this);
+    disconnect(widget, &QObject::destroyed, this, &ShowLatencyTracker::widgetDestroyed);
+}
+
+//____________________________________________________________________
+void ShowLatencyTracker::widgetDestroyed(QObject *object)
+{
+    _widgets.remove(object);
+}
+
+//____________________________________________________________________
+bool ShowLatencyTracker::eventFilter(QObject *object, QEvent *event)
+{
+    switch (event->type()) {
+    case QEvent::PlatformSurface:
+        // the native window is created before the first show event is sent
+        if (static_cast<QPlatformSurfaceEvent *>(event)->surfaceEventType() != QPlatformSurfaceEvent::SurfaceCreated) {
+            break;
+        }
+        Q_FALLTHROUGH();
+
+    case QEvent::Show: {
+        auto it = _widgets.find(object);
+        if (it != _widgets.end() && !it.value().isValid()) {
+            it.value().start();
+        }
+        break;
+    }
+
+    case QEvent::Paint: {
+        auto it = _widgets.constFind(object);
+        if (it == _widgets.constEnd() || !it.value().isValid()) {
+            break;
+        }
+
+        // report once the paint event has been processed
+        QPointer<QWidget> widget(static_cast<QWidget *>(object));
+        QMetaObject::invokeMethod(
+            this,
+            [this, widget]() {
+                if (widget) {
+                    report(widget);
+                }
+            },
+            Qt::QueuedConnection);
+        break;
+    }
+
+    case QEvent::Hide: {
+        // hidden before being painted
+        auto it = _widgets.find(object);
+        if (it != _widgets.end()) {
+            it.value().invalidate();
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+//____________________________________________________________________
+void ShowLatencyTracker::report(const QWidget *widget)
+{
+    auto it = _widgets.find(widget);
+    if (it == _widgets.end() || !it.value().isValid()) {
+        return;
+    }
+
+    const qint64 latency(it.value().nsecsElapsed() / 1000);
+    it.value().invalidate();
+
+    const bool isMenu(qobject_cast<const QMenu *>(widget));
+    Statistics &statistics(isMenu ? _menuStatistics : _toolTipStatistics);
+    ++statistics.count;
+    statistics.total += latency;
+    statistics.maximum = qMax(statistics.maximum, latency);
+
+    qCDebug(HELIUM).nospace() << "ShowLatencyTracker: " << (isMenu ? "menu" : "tooltip") << " " << widget->metaObject()->className() << " shown in "
+                              << latency << "us (average " << statistics.total / statistics.count << "us, maximum " << statistics.maximum << "us over "
+                              << statistics.count << ")";
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QHash>
+#include <QObject>
+#include <QWidget>
+
+namespace Breeze
+{
+
+//* measures how long menus and tooltips take from being shown to their first paint
+/**
+the show path covers native window creation, shadow and blur setup, and the first paint.
+Timings are only collected when debug output is enabled for the style logging category,
+and are reported along with a running average and maximum per kind of popup
+*/
+class ShowLatencyTracker : public QObject
+{
+    Q_OBJECT
+
+public:
+    //* constructor
+    explicit ShowLatencyTracker();
+
+    //* true if timings are collected
+    static bool isEnabled();
+
+    //* register widget
+    void registerWidget(QWidget *);
+
+    //* unregister widget
+    void unregisterWidget(QWidget *);
+
+    //* event filter
+    bool eventFilter(QObject *, QEvent *) override;
+
+protected Q_SLOTS:
+
+    //* unregister widget
+    void widgetDestroyed(QObject *);
+
+private:
+    //* report the latency of a widget whose first paint has been processed
+    void report(const QWidget *);
+
+    //* registered widgets, with a valid timer while being shown
+    QHash<const QObject *, QElapsedTimer> _widgets;
+
+    //* running statistics, in microseconds
+    struct Statistics {
+        int count = 0;
+        qint64 total = 0;
+        qint64 maximum = 0;
+    };
+
+    Statistics _menuStatistics;
+    Statistics _toolTipStatistics;
+};
+
+}
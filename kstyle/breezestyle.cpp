@@ -16,16 +16,18 @@
 #include "breezemnemonics.h"
 #include "breezepropertynames.h"
 #include "breezeshadowhelper.h"
+#include "breezeshowlatencytracker.h"
 #include "breezesplitterproxy.h"
 #include "breezestyleconfigdata.h"
 #include "breezetoolsareamanager.h"
 #include "breezewidgetexplorer.h"
+#include "breezewidgetflags.h"
 #include "breezewindowmanager.h"
 #include "decorationcolors.h"
+#include "tracing.h"
 
 #include <KColorUtils>
 #include <KIconLoader>
-#include <KWindowEffects>
 #include <kguiaddons_version.h>
 
 #include <QApplication>
@@ -35,28 +37,35 @@
 #include <QDial>
 #include <QDialog>
 #include <QDialogButtonBox>
+#include <QElapsedTimer>
 #include <QFormLayout>
 #include <QGraphicsItem>
 #include <QGraphicsProxyWidget>
 #include <QGraphicsView>
 #include <QGroupBox>
 #include <QItemDelegate>
+#include <QLabel>
 #include <QLineEdit>
 #include <QMainWindow>
 #include <QMdiArea>
 #include <QMenu>
+#include <QMenuBar>
 #include <QMetaEnum>
 #include <QMouseEvent>
 #include <QPainter>
 #include <QPushButton>
 #include <QRadioButton>
+#include <QScreen>
 #include <QScrollBar>
+#include <QSplitter>
 #include <QSplitterHandle>
 #include <QStackedLayout>
+#include <QTabBar>
 #include <QTextEdit>
 #include <QToolBar>
 #include <QToolBox>
 #include <QToolButton>
+#include <QToolTip>
 #include <QTreeView>
 #include <QWidgetAction>
 #include <memory>
@@ -286,6 +295,8 @@ Style::Style()
     , _splitterFactory(std::make_unique<SplitterFactory>())
     , _toolsAreaManager(std::make_unique<ToolsAreaManager>(_helper))
     , _widgetExplorer(std::make_unique<WidgetExplorer>())
+    , _widgetFlags(std::make_unique<WidgetFlags>())
+    , _showLatencyTracker(std::make_unique<ShowLatencyTracker>())
     , _tabBarData(std::make_unique<BreezePrivate::TabBarData>())
 #if BREEZE_HAVE_KSTYLE
     , SH_ArgbDndWindow(newStyleHint(QStringLiteral("SH_ArgbDndWindow")))
@@ -357,21 +368,37 @@ void Style::polish(QWidget *widget)
         return;
     }
 
+    // register widget flags first, so that they are available to the other helpers
+    _widgetFlags->registerWidget(widget);
+
+    // only hand the widget to helpers that can accept its class
+    const PolishFlags flags(polishFlags(widget));
+
     // register widget to animations
     _animations->registerWidget(widget);
     _windowManager->registerWidget(widget);
-    _frameShadowFactory->registerWidget(widget, _helper);
-    _mdiWindowShadowFactory->registerWidget(widget);
-    _shadowHelper->registerWidget(widget);
-    _splitterFactory->registerWidget(widget);
+    if (flags.testFlag(PolishFrameShadow)) {
+        _frameShadowFactory->registerWidget(widget, _helper);
+    }
+    if (flags.testFlag(PolishMdiWindowShadow)) {
+        _mdiWindowShadowFactory->registerWidget(widget);
+    }
+    if (flags.testFlag(PolishShadow) || widget->isWindow()) {
+        _shadowHelper->registerWidget(widget);
+    }
+    if (flags.testFlag(PolishSplitter)) {
+        _splitterFactory->registerWidget(widget);
+    }
     _toolsAreaManager->registerWidget(widget);
+    if (flags.testFlag(PolishMnemonics)) {
+        _mnemonics->registerWidget(widget);
+    }
+    if (flags.testFlag(PolishShowLatency)) {
+        _showLatencyTracker->registerWidget(widget);
+    }
 
     // enable mouse over effects for all necessary widgets
-    if (qobject_cast<QAbstractItemView *>(widget) || qobject_cast<QAbstractSpinBox *>(widget) || qobject_cast<QCheckBox *>(widget)
-        || qobject_cast<QComboBox *>(widget) || qobject_cast<QDial *>(widget) || qobject_cast<QLineEdit *>(widget) || qobject_cast<QPushButton *>(widget)
-        || qobject_cast<QRadioButton *>(widget) || qobject_cast<QScrollBar *>(widget) || qobject_cast<QSlider *>(widget)
-        || qobject_cast<QSplitterHandle *>(widget) || qobject_cast<QTabBar *>(widget) || qobject_cast<QTextEdit *>(widget)
-        || qobject_cast<QToolButton *>(widget) || widget->inherits("KTextEditor::View")) {
+    if (flags.testFlag(PolishHover)) {
         widget->setAttribute(Qt::WA_Hover);
     }
 
@@ -540,6 +567,59 @@ void Style::polish(QWidget *widget)
     ParentStyleClass::polish(widget);
 }
 
+//______________________________________________________________
+Style::PolishFlags Style::polishFlags(const QWidget *widget)
+{
+    const QMetaObject *metaObject(widget->metaObject());
+    auto it = _polishFlags.constFind(metaObject);
+    if (it != _polishFlags.constEnd()) {
+        return it.value();
+    }
+
+    PolishFlags flags;
+
+    // mouse over effects
+    if (qobject_cast<const QAbstractItemView *>(widget) || qobject_cast<const QAbstractSpinBox *>(widget) || qobject_cast<const QCheckBox *>(widget)
+        || qobject_cast<const QComboBox *>(widget) || qobject_cast<const QDial *>(widget) || qobject_cast<const QLineEdit *>(widget)
+        || qobject_cast<const QPushButton *>(widget) || qobject_cast<const QRadioButton *>(widget) || qobject_cast<const QScrollBar *>(widget)
+        || qobject_cast<const QSlider *>(widget) || qobject_cast<const QSplitterHandle *>(widget) || qobject_cast<const QTabBar *>(widget)
+        || qobject_cast<const QTextEdit *>(widget) || qobject_cast<const QToolButton *>(widget) || widget->inherits("KTextEditor::View")) {
+        flags |= PolishHover;
+    }
+
+    // the class checks below match the ones done first in each helper's registerWidget
+    if ((qobject_cast<const QFrame *>(widget) && !qobject_cast<const QSplitter *>(widget)) || widget->inherits("KTextEditor::View")) {
+        flags |= PolishFrameShadow;
+    }
+
+    if (qobject_cast<const QMdiSubWindow *>(widget)) {
+        flags |= PolishMdiWindowShadow;
+    }
+
+    // windows are always passed to the shadow helper, as their window type and properties can also request a shadow
+    if (qobject_cast<const QMenu *>(widget) || widget->inherits("QComboBoxPrivateContainer") || widget->inherits("QTipLabel")
+        || qobject_cast<const QDockWidget *>(widget) || qobject_cast<const QToolBar *>(widget)) {
+        flags |= PolishShadow;
+    }
+
+    if (qobject_cast<const QMainWindow *>(widget) || qobject_cast<const QSplitterHandle *>(widget)) {
+        flags |= PolishSplitter;
+    }
+
+    if (qobject_cast<const QAbstractButton *>(widget) || qobject_cast<const QLabel *>(widget) || qobject_cast<const QGroupBox *>(widget)
+        || qobject_cast<const QTabBar *>(widget) || qobject_cast<const QMenuBar *>(widget) || qobject_cast<const QMenu *>(widget)
+        || qobject_cast<const QDockWidget *>(widget)) {
+        flags |= PolishMnemonics;
+    }
+
+    if (qobject_cast<const QMenu *>(widget) || widget->inherits("QTipLabel")) {
+        flags |= PolishShowLatency;
+    }
+
+    _polishFlags.insert(metaObject, flags);
+    return flags;
+}
+
 //______________________________________________________________
 void Style::polishScrollArea(QAbstractScrollArea *scrollArea)
 {
@@ -623,6 +703,9 @@ void Style::unpolish(QWidget *widget)
     _splitterFactory->unregisterWidget(widget);
     _blurHelper->unregisterWidget(widget);
     _toolsAreaManager->unregisterWidget(widget);
+    _mnemonics->unregisterWidget(widget);
+    _showLatencyTracker->unregisterWidget(widget);
+    _widgetFlags->unregisterWidget(widget);
 
     // remove event filter
     if (qobject_cast<QAbstractScrollArea *>(widget) || qobject_cast<QDockWidget *>(widget) || qobject_cast<QMdiSubWindow *>(widget)
@@ -630,6 +713,18 @@ void Style::unpolish(QWidget *widget)
         widget->removeEventFilter(this);
     }
 
+    if (_scrollAreaChildren.remove(widget)) {
+        disconnect(widget, &QObject::destroyed, this, &Style::scrollAreaDestroyed);
+    }
+
+    if (_itemViewData.remove(widget)) {
+        disconnect(widget, &QObject::destroyed, this, &Style::itemViewDestroyed);
+    }
+
+    if (_menuLayouts.remove(widget)) {
+        disconnect(widget, &QObject::destroyed, this, &Style::menuDestroyed);
+    }
+
     ParentStyleClass::unpolish(widget);
 }
 
@@ -719,11 +814,11 @@ int Style::pixelMetric(PixelMetric metric, const QStyleOption *option, const QWi
             return Metrics::Frame_FrameWidth;
         }
 
-        const auto forceFrame = widget->property(PropertyNames::forceFrame);
-        if (forceFrame.isValid() && !forceFrame.toBool()) {
+        const auto flags(_widgetFlags->flags(widget));
+        if (flags.testFlag(WidgetFlags::HasForceFrame) && !flags.testFlag(WidgetFlags::ForceFrame)) {
             return 0;
         }
-        if ((forceFrame.isValid() && forceFrame.toBool()) || widget->property(PropertyNames::bordersSides).isValid()) {
+        if (flags.testFlag(WidgetFlags::ForceFrame) || flags.testFlag(WidgetFlags::HasBordersSides)) {
             return Metrics::Frame_FrameWidth;
         }
 
@@ -1185,6 +1280,8 @@ QStyle::SubControl Style::hitTestComplexControl(ComplexControl control, const QS
 //______________________________________________________________
 void Style::drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const
 {
+    HELIUM_TRACE_SCOPE("style", "Style::drawPrimitive");
+
     StylePrimitive fcn;
     switch (element) {
     case PE_PanelButtonCommand:
@@ -1332,6 +1429,8 @@ bool Style::drawWidgetPrimitive(const QStyleOption *option, QPainter *painter, c
 //______________________________________________________________
 void Style::drawControl(ControlElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const
 {
+    HELIUM_TRACE_SCOPE("style", "Style::drawControl");
+
     StyleControl fcn;
 
 #if BREEZE_HAVE_KSTYLE
@@ -1455,6 +1554,8 @@ void Style::drawControl(ControlElement element, const QStyleOption *option, QPai
 //______________________________________________________________
 void Style::drawComplexControl(ComplexControl element, const QStyleOptionComplex *option, QPainter *painter, const QWidget *widget) const
 {
+    HELIUM_TRACE_SCOPE("style", "Style::drawComplexControl");
+
     StyleComplexControl fcn;
     switch (element) {
     case CC_GroupBox:
@@ -1619,7 +1720,7 @@ bool Style::eventFilter(QObject *object, QEvent *event)
         if (widget->objectName() == QLatin1String("KPageView::Search") || widget->objectName() == QLatin1String("KPageView::TitleWidget")) {
             return eventFilterPageViewHeader(widget, event);
         } else if (auto dialogButtonBox = qobject_cast<QDialogButtonBox *>(object)) {
-            if (widget->property(PropertyNames::forceFrame).toBool() || (widget->parentWidget() && widget->parentWidget()->inherits("KPageView"))) {
+            if (_widgetFlags->flags(widget).testFlag(WidgetFlags::ForceFrame) || (widget->parentWidget() && widget->parentWidget()->inherits("KPageView"))) {
                 // QDialogButtonBox has no paintEvent
                 return eventFilterDialogButtonBox(dialogButtonBox, event);
             }
@@ -1699,15 +1800,15 @@ bool Style::eventFilterScrollArea(QWidget *widget, QEvent *event)
         }
 
         // get scrollarea horizontal and vertical containers
-        QWidget *child(nullptr);
         QList<QWidget *> children;
         if (!widget->inherits("QComboBoxListView")) {
-            if ((child = scrollArea->findChild<QWidget *>("qt_scrollarea_vcontainer")) && child->isVisible()) {
-                children.append(child);
+            const auto &cachedChildren(scrollAreaChildren(scrollArea));
+            if (cachedChildren.verticalContainer && cachedChildren.verticalContainer->isVisible()) {
+                children.append(cachedChildren.verticalContainer);
             }
 
-            if ((child = scrollArea->findChild<QWidget *>("qt_scrollarea_hcontainer")) && child->isVisible()) {
-                children.append(child);
+            if (cachedChildren.horizontalContainer && cachedChildren.horizontalContainer->isVisible()) {
+                children.append(cachedChildren.horizontalContainer);
             }
         }
 
@@ -1767,7 +1868,11 @@ bool Style::eventFilterScrollArea(QWidget *widget, QEvent *event)
             }
 
         } else if (widget->inherits("KTextEditor::View")) {
-            scrollBars = widget->findChildren<QScrollBar *>();
+            for (const auto &scrollBar : scrollAreaChildren(widget).scrollBars) {
+                if (scrollBar) {
+                    scrollBars.append(scrollBar);
+                }
+            }
         }
 
         // loop over found scrollbars
@@ -1809,6 +1914,11 @@ bool Style::eventFilterScrollArea(QWidget *widget, QEvent *event)
         break;
     }
 
+    case QEvent::ChildAdded:
+    case QEvent::ChildRemoved:
+        _scrollAreaChildren.remove(widget);
+        break;
+
     default:
         break;
     }
@@ -1816,6 +1926,167 @@ bool Style::eventFilterScrollArea(QWidget *widget, QEvent *event)
     return ParentStyleClass::eventFilter(widget, event);
 }
 
+//____________________________________________________________________________
+const Style::ScrollAreaChildren &Style::scrollAreaChildren(QWidget *widget)
+{
+    auto it = _scrollAreaChildren.find(widget);
+    if (it != _scrollAreaChildren.end()) {
+        return it.value();
+    }
+
+    // drop the entry with the scroll area
+    connect(widget, &QObject::destroyed, this, &Style::scrollAreaDestroyed, Qt::UniqueConnection);
+
+    ScrollAreaChildren children;
+    if (qobject_cast<QAbstractScrollArea *>(widget)) {
+        children.verticalContainer = widget->findChild<QWidget *>(QStringLiteral("qt_scrollarea_vcontainer"));
+        children.horizontalContainer = widget->findChild<QWidget *>(QStringLiteral("qt_scrollarea_hcontainer"));
+    } else {
+        const auto scrollBars = widget->findChildren<QScrollBar *>();
+        for (QScrollBar *scrollBar : scrollBars) {
+            children.scrollBars.append(scrollBar);
+        }
+    }
+
+    return _scrollAreaChildren.insert(widget, children).value();
+}
+
+//____________________________________________________________________________
+void Style::scrollAreaDestroyed(QObject *object)
+{
+    _scrollAreaChildren.remove(object);
+}
+
+//____________________________________________________________________________
+Style::ItemViewData &Style::itemViewData(const QWidget *widget) const
+{
+    auto it = _itemViewData.find(widget);
+    if (it != _itemViewData.end()) {
+        return it.value();
+    }
+
+    // drop the entry with the widget
+    connect(widget, &QObject::destroyed, this, &Style::itemViewDestroyed, Qt::UniqueConnection);
+
+    ItemViewData data;
+    data.view = qobject_cast<const QAbstractItemView *>(widget);
+    return _itemViewData.insert(widget, data).value();
+}
+
+//____________________________________________________________________________
+void Style::itemViewDestroyed(QObject *object)
+{
+    _itemViewData.remove(object);
+}
+
+//____________________________________________________________________________
+Style::MenuLayout &Style::menuLayout(const QStyleOptionMenuItem *option, const QWidget *widget) const
+{
+    // labels of menus whose actions are regularly replaced, like recent documents, would otherwise accumulate
+    static constexpr int maxLabels = 256;
+
+    MenuLayout *layout(&_defaultMenuLayout);
+    if (const QObject *menu = widget ? widget : option->styleObject) {
+        auto it = _menuLayouts.find(menu);
+        if (it == _menuLayouts.end()) {
+            // drop the entry with the menu
+            connect(menu, &QObject::destroyed, this, &Style::menuDestroyed, Qt::UniqueConnection);
+            it = _menuLayouts.insert(menu, MenuLayout());
+        }
+
+        layout = &it.value();
+    }
+
+    const qreal devicePixelRatio(widget ? widget->devicePixelRatioF() : qApp->devicePixelRatio());
+    const bool tabletMode(isTabletMode());
+    if (layout->configurationRevision != _configurationRevision || layout->devicePixelRatio != devicePixelRatio || layout->tabletMode != tabletMode
+        || layout->font != option->font) {
+        *layout = MenuLayout();
+        layout->font = option->font;
+        layout->devicePixelRatio = devicePixelRatio;
+        layout->tabletMode = tabletMode;
+        layout->configurationRevision = _configurationRevision;
+
+        layout->drawStrongFocus = StyleConfigData::menuItemDrawStrongFocus();
+        layout->translucent = StyleConfigData::menuOpacity() < 100;
+
+        layout->qtQuickControl = isQtQuickControl(option, widget);
+        layout->smallIconSize = pixelMetric(PM_SmallIconSize, option, widget);
+
+        layout->sectionFont = option->font;
+        layout->sectionFont.setBold(true);
+        layout->sectionFontMetrics.emplace(layout->sectionFont);
+
+    } else if (layout->labelSizes.size() + layout->labelHeights.size() + layout->sectionLabelWidths.size() > maxLabels) {
+        layout->labelSizes.clear();
+        layout->labelHeights.clear();
+        layout->sectionLabelWidths.clear();
+    }
+
+    return *layout;
+}
+
+//____________________________________________________________________________
+const Style::MenuItemGeometry &Style::menuItemGeometry(MenuLayout &layout, const QStyleOptionMenuItem *option, const QWidget *) const
+{
+    const QSize size(option->rect.size());
+    const bool hasCheckBox(option->menuHasCheckableItems);
+
+    int iconWidth = 0;
+    if (showIconsInMenuItems()) {
+        iconWidth = layout.qtQuickControl ? qMax(layout.smallIconSize, option->maxIconWidth) : option->maxIconWidth;
+    }
+
+    // items of a menu usually share the same size and left column
+    MenuItemGeometry &geometry(layout.itemGeometry);
+    if (geometry.size == size && geometry.hasCheckBox == hasCheckBox && geometry.iconWidth == iconWidth) {
+        return geometry;
+    }
+
+    geometry = MenuItemGeometry();
+    geometry.size = size;
+    geometry.hasCheckBox = hasCheckBox;
+    geometry.iconWidth = iconWidth;
+
+    // get rect available for contents
+    auto contentsRect(insideMargin(QRect(QPoint(0, 0), size), Metrics::MenuItem_MarginWidth, (layout.tabletMode ? 2 : 1) * Metrics::MenuItem_MarginHeight));
+
+    // checkbox
+    if (hasCheckBox) {
+        geometry.checkBoxRect = QRect(contentsRect.left(),
+                                      contentsRect.top() + (contentsRect.height() - Metrics::CheckBox_Size) / 2,
+                                      Metrics::CheckBox_Size,
+                                      Metrics::CheckBox_Size);
+        contentsRect.setLeft(geometry.checkBoxRect.right() + Metrics::MenuItem_ItemSpacing + 1);
+    }
+
+    // icon
+    if (iconWidth > 0) {
+        geometry.iconRect = QRect(contentsRect.left(), contentsRect.top() + (contentsRect.height() - iconWidth) / 2, iconWidth, iconWidth);
+        contentsRect.setLeft(geometry.iconRect.right() + Metrics::MenuItem_ItemSpacing + 1);
+        const QSize iconSize(layout.smallIconSize, layout.smallIconSize);
+        geometry.iconRect = centerRect(geometry.iconRect, iconSize);
+    } else {
+        contentsRect.setLeft(contentsRect.left() + Metrics::MenuItem_ExtraLeftMargin);
+    }
+
+    // arrow
+    geometry.arrowRect = QRect(contentsRect.right() - Metrics::MenuButton_IndicatorWidth + 1,
+                               contentsRect.top() + (contentsRect.height() - Metrics::MenuButton_IndicatorWidth) / 2,
+                               Metrics::MenuButton_IndicatorWidth,
+                               Metrics::MenuButton_IndicatorWidth);
+    contentsRect.setRight(geometry.arrowRect.left() - Metrics::MenuItem_ItemSpacing - 1);
+
+    geometry.textRect = contentsRect;
+    return geometry;
+}
+
+//____________________________________________________________________________
+void Style::menuDestroyed(QObject *object)
+{
+    _menuLayouts.remove(object);
+}
+
 //_________________________________________________________
 bool Style::eventFilterComboBoxContainer(QWidget *widget, QEvent *event)
 {
@@ -1961,7 +2232,7 @@ void Style::drawToolsAreaSeparator(QPainter *painter, const QWidget *w) const
         return;
     }
 
-    if (w->property(PropertyNames::noSeparator).toBool() || w->isFullScreen()) {
+    if (_widgetFlags->flags(w).testFlag(WidgetFlags::NoSeparator) || w->isFullScreen()) {
         return;
     }
     painter->setCompositionMode(QPainter::CompositionMode_SourceOver);
@@ -1990,8 +2261,8 @@ void Style::drawToolsAreaBackgroundAndSeparator(QPainter *painter, const QWidget
                 if ((w->testAttribute(Qt::WA_WState_Created) || w->internalWinId())) {
                     // PAM: modified from breezeblurhelper.cpp -- did not use _blurHelper->registerWidget() as it doesn't allow you to specify a region, hence
                     // blurring the entire window and causing kornerbug
-                    w->winId(); // force creation of the window handle
-                    KWindowEffects::enableBlurBehind(w->windowHandle(), true, rect);
+                    // the region is submitted after painting, and only when it changed
+                    _blurHelper->setBlurRegion(const_cast<QWidget *>(w), rect);
 
                     // no force update at this point like in breezeblurhelper.cpp, as already drawing next and creates an infinite loop
                 }
@@ -2347,6 +2618,9 @@ void Style::loadConfiguration()
     // load helper configuration
     _helper->loadConfig();
 
+    // invalidate menu layouts
+    ++_configurationRevision;
+
     _toolsAreaManager->configUpdated();
 
     loadGlobalAnimationSettings();
@@ -2409,6 +2683,50 @@ void Style::loadConfiguration()
     // widget explorer
     _widgetExplorer->setEnabled(StyleConfigData::widgetExplorerEnabled());
     _widgetExplorer->setDrawWidgetRects(StyleConfigData::drawWidgetRects());
+
+    // prepare menu and tooltip resources once pending events have been processed
+    if (!_prewarmQueued) {
+        _prewarmQueued = true;
+        QMetaObject::invokeMethod(this, &Style::prewarmMenuResources, Qt::QueuedConnection);
+    }
+}
+
+//___________________________________________________________________________________________________________________
+void Style::prewarmMenuResources()
+{
+    _prewarmQueued = false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // shadow tiles, for every screen scale, once a menu or tooltip needs them
+    _shadowHelper->scheduleWarmShadowTiles();
+
+    // blur region of translucent menus
+    _helper->warmMenuFrameRegion();
+
+    // menu and tooltip frames, with the colors used in drawPanelMenuPrimitive and drawPanelTipLabelPrimitive.
+    // Translucent menus are painted with CompositionMode_Source, which does not go through the frame cache
+    const QPalette menuPalette(QApplication::palette("QMenu"));
+    const QPalette toolTipPalette(QToolTip::palette());
+    const QColor toolTipBackground(toolTipPalette.color(QPalette::ToolTipBase));
+    const QColor toolTipOutline(KColorUtils::mix(toolTipBackground, toolTipPalette.color(QPalette::ToolTipText), 0.25));
+    const bool opaqueMenus(StyleConfigData::menuOpacity() >= 100);
+
+    QSet<qreal> devicePixelRatios;
+    const auto screens = QGuiApplication::screens();
+    for (const QScreen *screen : screens) {
+        devicePixelRatios.insert(screen->devicePixelRatio());
+    }
+
+    for (const qreal devicePixelRatio : std::as_const(devicePixelRatios)) {
+        if (opaqueMenus) {
+            _helper->warmMenuFrame(_helper->frameBackgroundColor(menuPalette), _helper->frameOutlineColor(menuPalette), devicePixelRatio);
+        }
+        _helper->warmMenuFrame(toolTipBackground, toolTipOutline, devicePixelRatio);
+    }
+
+    qCDebug(HELIUM) << "Style::prewarmMenuResources: menu resources prepared in" << timer.nsecsElapsed() / 1000 << "us";
 }
 
 //___________________________________________________________________________________________________________________
@@ -2540,10 +2858,10 @@ QRect Style::progressBarContentsRect(const QStyleOption *option, const QWidget *
 //___________________________________________________________________________________________________________________
 QRect Style::frameContentsRect(const QStyleOption *option, const QWidget *widget) const
 {
+    const auto flags(widget ? _widgetFlags->flags(widget) : WidgetFlags::Flags());
     if (widget) {
-        const auto borders = widget->property(PropertyNames::bordersSides);
-        if (borders.isValid() && borders.canConvert<Qt::Edges>()) {
-            const auto value = borders.value<Qt::Edges>();
+        if (flags.testFlag(WidgetFlags::HasBordersSides)) {
+            const auto value = WidgetFlags::bordersSides(flags);
             auto rect = option->rect;
 
             if ((value & Qt::LeftEdge && widget->layoutDirection() == Qt::LeftToRight)
@@ -2565,8 +2883,7 @@ QRect Style::frameContentsRect(const QStyleOption *option, const QWidget *widget
         }
     }
 
-    if (!StyleConfigData::sidePanelDrawFrame() && qobject_cast<const QAbstractScrollArea *>(widget)
-        && widget->property(PropertyNames::sidePanelView).toBool()) {
+    if (!StyleConfigData::sidePanelDrawFrame() && qobject_cast<const QAbstractScrollArea *>(widget) && flags.testFlag(WidgetFlags::SidePanelView)) {
         // adjust margins for sidepanel widgets
         return option->rect.adjusted(0, 0, -1, 0);
 
@@ -3902,13 +4219,19 @@ QSize Style::menuItemSizeFromContents(const QStyleOption *option, const QSize &c
             text = text.left(acceleratorSeparatorPos);
         }
 
-        QFontMetrics fm(menuItemOption->font);
-        QSize size = fm.boundingRect({}, Qt::TextHideMnemonic, text).size();
+        MenuLayout &layout(menuLayout(menuItemOption, widget));
+
+        auto it = layout.labelSizes.constFind(text);
+        if (it == layout.labelSizes.constEnd()) {
+            QFontMetrics fm(menuItemOption->font);
+            it = layout.labelSizes.insert(text, fm.boundingRect({}, Qt::TextHideMnemonic, text).size());
+        }
+
+        QSize size = it.value();
 
         int iconWidth = 0;
         if (showIconsInMenuItems()) {
-            iconWidth = isQtQuickControl(option, widget) ? qMax(pixelMetric(PM_SmallIconSize, option, widget), menuItemOption->maxIconWidth)
-                                                         : menuItemOption->maxIconWidth;
+            iconWidth = layout.qtQuickControl ? qMax(layout.smallIconSize, menuItemOption->maxIconWidth) : menuItemOption->maxIconWidth;
         }
 
         int leftColumnWidth = 0;
@@ -3943,7 +4266,7 @@ QSize Style::menuItemSizeFromContents(const QStyleOption *option, const QSize &c
         size.setHeight(qMax(size.height(), int(Metrics::MenuButton_IndicatorWidth)));
         size.setHeight(qMax(size.height(), int(Metrics::CheckBox_Size)));
         size.setHeight(qMax(size.height(), iconWidth));
-        return expandSize(size, Metrics::MenuItem_MarginWidth, (isTabletMode() ? 2 : 1) * Metrics::MenuItem_MarginHeight);
+        return expandSize(size, Metrics::MenuItem_MarginWidth, (layout.tabletMode ? 2 : 1) * Metrics::MenuItem_MarginHeight);
     }
 
     case QStyleOptionMenuItem::Separator: {
@@ -3956,17 +4279,21 @@ QSize Style::menuItemSizeFromContents(const QStyleOption *option, const QSize &c
         // If the menu item is a section, add width for text
         // and make height the same as other menu items, plus extra top padding.
         if (!menuItemOption->text.isEmpty()) {
-            auto font = menuItemOption->font;
-            font.setBold(true);
-            QFontMetrics fm(font);
-            QRect textRect = fm.boundingRect({}, Qt::TextSingleLine | Qt::TextHideMnemonic, menuItemOption->text);
-            w = qMax(w, textRect.width());
-            h = qMax(h, fm.height());
+            MenuLayout &layout(menuLayout(menuItemOption, widget));
+
+            auto it = layout.sectionLabelWidths.constFind(menuItemOption->text);
+            if (it == layout.sectionLabelWidths.constEnd()) {
+                const QRect textRect = layout.sectionFontMetrics->boundingRect({}, Qt::TextSingleLine | Qt::TextHideMnemonic, menuItemOption->text);
+                it = layout.sectionLabelWidths.insert(menuItemOption->text, textRect.width());
+            }
+
+            w = qMax(w, it.value());
+            h = qMax(h, layout.sectionFontMetrics->height());
 
             if (showIconsInMenuItems()) {
                 int iconWidth = menuItemOption->maxIconWidth;
-                if (isQtQuickControl(option, widget)) {
-                    iconWidth = qMax(pixelMetric(PM_SmallIconSize, option, widget), iconWidth);
+                if (layout.qtQuickControl) {
+                    iconWidth = qMax(layout.smallIconSize, iconWidth);
                 }
                 h = qMax(h, iconWidth);
             }
@@ -4212,16 +4539,17 @@ bool Style::drawFramePrimitive(const QStyleOption *option, QPainter *painter, co
     const AnimationMode mode(_animations->inputWidgetEngine().frameAnimationMode(widget));
     const qreal opacity(_animations->inputWidgetEngine().frameOpacity(widget));
 
-    if (widget && widget->property(PropertyNames::bordersSides).isValid()) {
+    const auto flags(widget ? _widgetFlags->flags(widget) : WidgetFlags::Flags());
+    if (flags.testFlag(WidgetFlags::HasBordersSides)) {
         const auto background(palette.base().color());
         const auto outline(_helper->frameOutlineColor(palette));
-        _helper->renderFrameWithSides(painter, rect, background, widget->property(PropertyNames::bordersSides).value<Qt::Edges>(), outline);
+        _helper->renderFrameWithSides(painter, rect, background, WidgetFlags::bordersSides(flags), outline);
 
         return true;
     }
 
     // render
-    if (!StyleConfigData::sidePanelDrawFrame() && widget && widget->property(PropertyNames::sidePanelView).toBool()) {
+    if (!StyleConfigData::sidePanelDrawFrame() && flags.testFlag(WidgetFlags::SidePanelView)) {
         const auto outline(_helper->sidePanelOutlineColor(palette, hasFocus, opacity, mode));
         const bool reverseLayout(option->direction == Qt::RightToLeft);
         const Side side(reverseLayout ? SideRight : SideLeft);
@@ -4250,9 +4578,9 @@ bool Style::drawFrameLineEditPrimitive(const QStyleOption *option, QPainter *pai
     const auto &rect(option->rect);
 
     if (widget) {
-        const auto borders = widget->property(PropertyNames::bordersSides);
-        if (borders.isValid()) {
-            const auto value = borders.value<Qt::Edges>();
+        const auto flags(_widgetFlags->flags(widget));
+        if (flags.testFlag(WidgetFlags::HasBordersSides)) {
+            const auto value = WidgetFlags::bordersSides(flags);
 
             // copy state
             const State &state(option->state);
@@ -4972,8 +5300,9 @@ bool Style::drawPanelItemViewItemPrimitive(const QStyleOption *option, QPainter
         return false;
     }
 
-    // try cast widget
-    const auto abstractItemView = qobject_cast<const QAbstractItemView *>(widget);
+    // cached item view data. The cast and the resolved colors are reused across cells and paint events
+    ItemViewData *itemView(widget ? &itemViewData(widget) : nullptr);
+    const auto abstractItemView(itemView ? itemView->view : nullptr);
 
     // store palette and rect
     const auto &palette(option->palette);
@@ -5003,11 +5332,21 @@ bool Style::drawPanelItemViewItemPrimitive(const QStyleOption *option, QPainter
         colorGroup = QPalette::Disabled;
     }
 
+    // resolve colors, unless already resolved for this palette
+    ItemViewColors uncachedColors;
+    ItemViewColors &colors(itemView ? itemView->colors[colorGroup] : uncachedColors);
+    if (colors.paletteCacheKey != palette.cacheKey()) {
+        colors.paletteCacheKey = palette.cacheKey();
+        colors.alternateBase = palette.brush(colorGroup, QPalette::AlternateBase);
+        colors.selection = palette.color(colorGroup, QPalette::Highlight);
+        colors.hover = colors.selection;
+        colors.hover.setAlphaF(0.2);
+        colors.selectedHover = colors.selection.lighter(110);
+    }
+
     // render alternate background
     if (hasAlternateBackground) {
-        painter->setPen(Qt::NoPen);
-        painter->setBrush(palette.brush(colorGroup, QPalette::AlternateBase));
-        painter->drawRect(rect);
+        painter->fillRect(rect, colors.alternateBase);
     }
 
     // stop here if no highlight is needed
@@ -5025,21 +5364,14 @@ bool Style::drawPanelItemViewItemPrimitive(const QStyleOption *option, QPainter
     }
 
     // render selection
-    // define color
+    // define color, changed to implement mouse over
     QColor color;
     if (hasCustomBackground && hasSolidBackground) {
         color = viewItemOption->backgroundBrush.color();
+    } else if (mouseOver) {
+        color = selected ? colors.selectedHover : colors.hover;
     } else {
-        color = palette.color(colorGroup, QPalette::Highlight);
-    }
-
-    // change color to implement mouse over
-    if (mouseOver && !hasCustomBackground) {
-        if (!selected) {
-            color.setAlphaF(0.2);
-        } else {
-            color = color.lighter(110);
-        }
+        color = colors.selection;
     }
 
     // render
@@ -5081,9 +5413,16 @@ bool Style::drawIndicatorCheckBoxPrimitive(const QStyleOption *option, QPainter
     const qreal opacity(_animations->widgetStateEngine().opacity(widget, AnimationHover));
 
     // render
-    _helper->renderCheckBoxBackground(painter, rect, palette, checkBoxState, hasHighlightNeutral(widget, option, mouseOver), sunken, animation);
-    _helper
-        ->renderCheckBox(painter, rect, palette, mouseOver, checkBoxState, target, hasHighlightNeutral(widget, option, mouseOver), sunken, animation, opacity);
+    _helper->renderCheckBoxIndicator(painter,
+                                     rect,
+                                     palette,
+                                     mouseOver,
+                                     checkBoxState,
+                                     target,
+                                     hasHighlightNeutral(widget, option, mouseOver),
+                                     sunken,
+                                     animation,
+                                     opacity);
     return true;
 }
 
@@ -5115,8 +5454,15 @@ bool Style::drawIndicatorRadioButtonPrimitive(const QStyleOption *option, QPaint
     const qreal opacity(_animations->widgetStateEngine().opacity(widget, AnimationHover));
 
     // render
-    _helper->renderRadioButtonBackground(painter, rect, palette, radioButtonState, hasHighlightNeutral(widget, option, mouseOver), sunken, animation);
-    _helper->renderRadioButton(painter, rect, palette, mouseOver, radioButtonState, hasHighlightNeutral(widget, option, mouseOver), sunken, animation, opacity);
+    _helper->renderRadioButtonIndicator(painter,
+                                        rect,
+                                        palette,
+                                        mouseOver,
+                                        radioButtonState,
+                                        hasHighlightNeutral(widget, option, mouseOver),
+                                        sunken,
+                                        animation,
+                                        opacity);
 
     return true;
 }
@@ -6027,13 +6373,16 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
     const bool selected = enabled && (state & State_Selected);
     const bool sunken = enabled && (state & (State_Sunken));
     const bool reverseLayout = option->direction == Qt::RightToLeft;
-    const bool useStrongFocus = StyleConfigData::menuItemDrawStrongFocus();
+
+    // metrics and configuration shared by the items of the menu
+    MenuLayout &layout(menuLayout(menuItemOption, widget));
+    const bool useStrongFocus = layout.drawStrongFocus;
 
     // deal with separators
     if (menuItemOption->menuItemType == QStyleOptionMenuItem::Separator) {
         auto contentsRect = rect.adjusted(Metrics::MenuItem_MarginWidth, 0, -Metrics::MenuItem_MarginWidth, 0);
         QColor separatorColor;
-        if (StyleConfigData::menuOpacity() < 100) {
+        if (layout.translucent) {
             separatorColor = _helper->alphaColor(palette.color(QPalette::WindowText), Metrics::Bias_Default);
         } else {
             separatorColor = _helper->separatorColor(palette);
@@ -6043,12 +6392,9 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
             contentsRect.adjust(0, Metrics::MenuItem_MarginHeight, 0, 0);
             int flags = visualAlignment(option->direction, Qt::AlignLeft) | Qt::AlignVCenter;
             flags |= Qt::TextSingleLine | Qt::TextHideMnemonic | Qt::TextDontClip;
-            auto font = menuItemOption->font;
-            font.setBold(true);
-            QFontMetrics fm(font);
-            auto textRect = fm.boundingRect(contentsRect, flags, menuItemOption->text);
+            auto textRect = layout.sectionFontMetrics->boundingRect(contentsRect, flags, menuItemOption->text);
             const auto &labelColor = palette.color(QPalette::Current, QPalette::WindowText);
-            painter->setFont(font);
+            painter->setFont(layout.sectionFont);
             painter->setBrush(Qt::NoBrush);
             // 0.7 is from Kirigami ListSectionHeader.
             // Not using painter->setOpacity() because it disables text antialiasing.
@@ -6098,19 +6444,11 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
         _helper->renderFocusRect(painter, rect, color, outlineColor, SideTop | SideBottom | SideLeft | SideRight);
     }
 
-    // get rect available for contents
-    auto contentsRect(insideMargin(rect, Metrics::MenuItem_MarginWidth, (isTabletMode() ? 2 : 1) * Metrics::MenuItem_MarginHeight));
+    // define relevant rectangles, shared by the items of the menu
+    const MenuItemGeometry &geometry(menuItemGeometry(layout, menuItemOption, widget));
 
-    // define relevant rectangles
     // checkbox
-    QRect checkBoxRect;
-    if (menuItemOption->menuHasCheckableItems) {
-        checkBoxRect = QRect(contentsRect.left(),
-                             contentsRect.top() + (contentsRect.height() - Metrics::CheckBox_Size) / 2,
-                             Metrics::CheckBox_Size,
-                             Metrics::CheckBox_Size);
-        contentsRect.setLeft(checkBoxRect.right() + Metrics::MenuItem_ItemSpacing + 1);
-    }
+    QRect checkBoxRect(geometry.checkBoxRect.translated(rect.topLeft()));
 
     // render checkbox indicator
     if (menuItemOption->checkType == QStyleOptionMenuItem::NonExclusive) {
@@ -6131,24 +6469,8 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
     }
 
     // icon
-    int iconMetric = 0;
-    int iconWidth = 0;
     const bool showIcon(showIconsInMenuItems());
-    if (showIcon) {
-        iconMetric = pixelMetric(PM_SmallIconSize, option, widget);
-        iconWidth = isQtQuickControl(option, widget) ? qMax(iconMetric, menuItemOption->maxIconWidth) : menuItemOption->maxIconWidth;
-    }
-
-    QRect iconRect;
-    if (showIcon && iconWidth > 0) {
-        iconRect = QRect(contentsRect.left(), contentsRect.top() + (contentsRect.height() - iconWidth) / 2, iconWidth, iconWidth);
-        contentsRect.setLeft(iconRect.right() + Metrics::MenuItem_ItemSpacing + 1);
-        const QSize iconSize(iconMetric, iconMetric);
-        iconRect = centerRect(iconRect, iconSize);
-    } else {
-        contentsRect.setLeft(contentsRect.left() + Metrics::MenuItem_ExtraLeftMargin);
-    }
-
+    QRect iconRect(geometry.iconRect.translated(rect.topLeft()));
     if (showIcon && !menuItemOption->icon.isNull()) {
         iconRect = visualRect(option, iconRect);
 
@@ -6168,12 +6490,7 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
     }
 
     // arrow
-    QRect arrowRect(contentsRect.right() - Metrics::MenuButton_IndicatorWidth + 1,
-                    contentsRect.top() + (contentsRect.height() - Metrics::MenuButton_IndicatorWidth) / 2,
-                    Metrics::MenuButton_IndicatorWidth,
-                    Metrics::MenuButton_IndicatorWidth);
-    contentsRect.setRight(arrowRect.left() - Metrics::MenuItem_ItemSpacing - 1);
-
+    QRect arrowRect(geometry.arrowRect.translated(rect.topLeft()));
     if (menuItemOption->menuItemType == QStyleOptionMenuItem::SubMenu) {
         // apply right-to-left layout
         arrowRect = visualRect(option, arrowRect);
@@ -6189,11 +6506,15 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
     }
 
     // text
-    auto textRect = contentsRect;
+    auto textRect(geometry.textRect.translated(rect.topLeft()));
     if (!menuItemOption->text.isEmpty()) {
         // adjust textRect
         QString text = menuItemOption->text;
-        textRect = centerRect(textRect, textRect.width(), option->fontMetrics.size(_mnemonics->textFlags(), text).height());
+        auto it = layout.labelHeights.constFind(text);
+        if (it == layout.labelHeights.constEnd()) {
+            it = layout.labelHeights.insert(text, option->fontMetrics.size(_mnemonics->textFlags(), text).height());
+        }
+        textRect = centerRect(textRect, textRect.width(), it.value());
         textRect = visualRect(option, textRect);
 
         // set font
@@ -8968,10 +9289,10 @@ bool Style::hasAlteredBackground(const QWidget *widget) const
         return false;
     }
 
-    // check property
-    const QVariant property(widget->property(PropertyNames::alteredBackground));
-    if (property.isValid()) {
-        return property.toBool();
+    // check property, or previously computed value
+    const auto flags(_widgetFlags->flags(widget));
+    if (flags.testFlag(WidgetFlags::HasAlteredBackground) || flags.testFlag(WidgetFlags::AlteredBackgroundResolved)) {
+        return flags.testFlag(WidgetFlags::AlteredBackground);
     }
 
     // check if widget is of relevant type
@@ -8989,7 +9310,10 @@ bool Style::hasAlteredBackground(const QWidget *widget) const
     if (widget->parentWidget() && !hasAlteredBackground) {
         hasAlteredBackground = this->hasAlteredBackground(widget->parentWidget());
     }
-    const_cast<QWidget *>(widget)->setProperty(PropertyNames::alteredBackground, hasAlteredBackground);
+    if (!_widgetFlags->setAlteredBackground(widget, hasAlteredBackground)) {
+        // widgets which are not polished keep the value as a property
+        const_cast<QWidget *>(widget)->setProperty(PropertyNames::alteredBackground, hasAlteredBackground);
+    }
     return hasAlteredBackground;
 }
 
@@ -9004,11 +9328,7 @@ bool Style::hasHighlightNeutral(const QObject *widget, const QStyleOption *optio
         styleObject = option->styleObject;
     }
 
-    const QVariant property(styleObject->property(PropertyNames::highlightNeutral));
-    if (property.isValid()) {
-        return property.toBool();
-    }
-    return false;
+    return _widgetFlags->flags(styleObject).testFlag(WidgetFlags::HighlightNeutral);
 }
 
 }
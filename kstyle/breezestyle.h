@@ -22,13 +22,18 @@
 #include <QCommonStyle>
 #include <QDockWidget>
 #include <QFocusFrame>
+#include <QFontMetrics>
 #include <QHash>
 #include <QIcon>
 #include <QMdiSubWindow>
+#include <QPointer>
+#include <QScrollBar>
 #include <QStyleOption>
 #include <QWidget>
 
+#include <array>
 #include <functional>
+#include <optional>
 
 class QDialogButtonBox;
 
@@ -46,8 +51,10 @@ class Helper;
 class MdiWindowShadowFactory;
 class Mnemonics;
 class ShadowHelper;
+class ShowLatencyTracker;
 class SplitterFactory;
 class WidgetExplorer;
+class WidgetFlags;
 class WindowManager;
 class BlurHelper;
 class ToolsAreaManager;
@@ -161,6 +168,9 @@ protected Q_SLOTS:
     //* set flag to regenerate cache of decorationColors and update configuration
     void generateDecorationColorsOnDecorationColorSettingsUpdate(QByteArray uuid);
 
+    //* render shadows, blur region templates and frames used by menus and tooltips, ahead of the first one shown
+    void prewarmMenuResources();
+
 protected:
     //* standard icons
     QIcon standardIcon(StandardPixmap pixmap, const QStyleOption *option = nullptr, const QWidget *widget = nullptr) const override
@@ -522,12 +532,149 @@ private:
     std::unique_ptr<SplitterFactory> _splitterFactory;
     std::unique_ptr<ToolsAreaManager> _toolsAreaManager;
     std::unique_ptr<WidgetExplorer> _widgetExplorer;
+    std::unique_ptr<WidgetFlags> _widgetFlags;
+    std::unique_ptr<ShowLatencyTracker> _showLatencyTracker;
     std::unique_ptr<BreezePrivate::TabBarData> _tabBarData;
 
+    //* true if prewarmMenuResources is already queued
+    bool _prewarmQueued = false;
+
+    //* incremented each time the configuration is loaded. Invalidates cached menu layouts
+    int _configurationRevision = 0;
+
     //* icon hash
     using IconCache = QHash<StandardPixmap, QIcon>;
     IconCache _iconCache;
 
+    //* children of a scroll area looked up in its event filter
+    struct ScrollAreaChildren {
+        //* scrollbar containers, painted behind in the paint event
+        QPointer<QWidget> verticalContainer;
+        QPointer<QWidget> horizontalContainer;
+
+        //* scrollbars receiving forwarded mouse events, for KTextEditor::View
+        QList<QPointer<QScrollBar>> scrollBars;
+    };
+
+    //* return cached children for given scroll area, looking them up if needed
+    const ScrollAreaChildren &scrollAreaChildren(QWidget *);
+
+    //* triggered by scroll area destruction
+    void scrollAreaDestroyed(QObject *);
+
+    //* scroll area children, invalidated on ChildAdded and ChildRemoved
+    QHash<const QObject *, ScrollAreaChildren> _scrollAreaChildren;
+
+    //* item view background colors, resolved for a given palette and color group
+    struct ItemViewColors {
+        //* cache key of the palette the colors were resolved from
+        qint64 paletteCacheKey = -1;
+
+        QBrush alternateBase;
+        QColor selection;
+        QColor hover;
+        QColor selectedHover;
+    };
+
+    //* item view painting data, for a given widget
+    struct ItemViewData {
+        //* widget as an item view, or nullptr if it is not one
+        const QAbstractItemView *view = nullptr;
+
+        //* colors, indexed by color group
+        std::array<ItemViewColors, QPalette::NColorGroups> colors;
+    };
+
+    //* return cached item view data for given widget, creating it if needed
+    ItemViewData &itemViewData(const QWidget *) const;
+
+    //* triggered by item view destruction
+    void itemViewDestroyed(QObject *);
+
+    //* item view data, kept until the widget is unpolished or destroyed
+    mutable QHash<const QObject *, ItemViewData> _itemViewData;
+
+    //* menu item sub rects, relative to the item rect, for a given item size and left column
+    struct MenuItemGeometry {
+        QSize size;
+        bool hasCheckBox = false;
+        int iconWidth = 0;
+
+        QRect checkBoxRect;
+        QRect iconRect;
+        QRect arrowRect;
+
+        //* text rect, before the accelerator and label are located
+        QRect textRect;
+    };
+
+    //* menu item layout data, shared by the items of a given menu
+    struct MenuLayout {
+        //* font, device pixel ratio, tablet mode and configuration revision the layout was computed for
+        QFont font;
+        qreal devicePixelRatio = 0;
+        bool tabletMode = false;
+        int configurationRevision = -1;
+
+        //* configuration
+        bool drawStrongFocus = false;
+        bool translucent = false;
+
+        //* menu properties
+        bool qtQuickControl = false;
+        int smallIconSize = 0;
+
+        //* bold font used for section labels
+        QFont sectionFont;
+        std::optional<QFontMetrics> sectionFontMetrics;
+
+        //* label sizes, as used in sizeFromContents, by label text
+        QHash<QString, QSize> labelSizes;
+
+        //* label heights, as used in drawMenuItemControl, by item text
+        QHash<QString, int> labelHeights;
+
+        //* section label widths, by label text
+        QHash<QString, int> sectionLabelWidths;
+
+        //* geometry of the last item laid out
+        MenuItemGeometry itemGeometry;
+    };
+
+    //* return cached layout for the menu of given option, reset if font, scale or configuration changed
+    MenuLayout &menuLayout(const QStyleOptionMenuItem *, const QWidget *) const;
+
+    //* return item sub rects for given menu item, computing them if the menu layout does not hold them yet
+    const MenuItemGeometry &menuItemGeometry(MenuLayout &, const QStyleOptionMenuItem *, const QWidget *) const;
+
+    //* triggered by menu destruction
+    void menuDestroyed(QObject *);
+
+    //* menu layouts, kept until the menu is unpolished or destroyed
+    mutable QHash<const QObject *, MenuLayout> _menuLayouts;
+
+    //* layout used for menu items that have neither a widget nor a style object
+    mutable MenuLayout _defaultMenuLayout;
+
+    //* what polish does for widgets of a given class
+    enum PolishFlag {
+        PolishHover = 1 << 0,
+        PolishFrameShadow = 1 << 1,
+        PolishMdiWindowShadow = 1 << 2,
+        PolishShadow = 1 << 3,
+        PolishSplitter = 1 << 4,
+        PolishMnemonics = 1 << 5,
+        PolishShowLatency = 1 << 6,
+    };
+    Q_DECLARE_FLAGS(PolishFlags, PolishFlag)
+
+    //* return polish flags for the class of given widget, classifying the class if needed
+    /** flags only depend on the widget class, so that the classification runs once per QMetaObject */
+    PolishFlags polishFlags(const QWidget *);
+
+    //* polish flags, keyed by class
+    QHash<const QMetaObject *, PolishFlags> _polishFlags;
+
     //* pointer to primitive specialized function
     using StylePrimitive = std::function<bool(const Style &, const QStyleOption *, QPainter *, const QWidget *)>;
     StylePrimitive _frameFocusPrimitive;
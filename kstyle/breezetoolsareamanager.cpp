@@ -38,6 +38,11 @@ void ToolsAreaManager::appendIfNotAlreadyExists(const QMainWindow *window, const
             removeWindow(window);
         });
     }
+
+    // follow the toolbar, should it be moved to another parent
+    _toolBarWindows.insert(toolBar.data(), window);
+    toolBar->removeEventFilter(this);
+    toolBar->installEventFilter(this);
 }
 
 void ToolsAreaManager::removeWindowToolBar(const QMainWindow *window, const QPointer<QToolBar> &toolBar)
@@ -48,15 +53,47 @@ void ToolsAreaManager::removeWindowToolBar(const QMainWindow *window, const QPoi
     if (windowIt != _windows.end()) {
         windowIt->toolBars.removeAll(toolBar);
     }
+
+    if (toolBar) {
+        _toolBarWindows.remove(toolBar.data());
+    }
 }
 
 void ToolsAreaManager::removeWindow(const QMainWindow *window)
 {
+    for (auto it = _toolBarWindows.begin(); it != _toolBarWindows.end();) {
+        if (it.value() == window || it.value().isNull()) {
+            it = _toolBarWindows.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
     std::erase_if(_windows, [window](const WindowToolBars &windowToolBars) {
         return window == windowToolBars.window;
     });
 }
 
+const QMainWindow *ToolsAreaManager::findMainWindow(QWidget *widget)
+{
+    ++_parentWalkCount;
+
+    const QMainWindow *mainWindow = nullptr;
+    for (QWidget *parent = widget; parent != nullptr; parent = parent->parentWidget()) {
+        if (qobject_cast<QMdiArea *>(parent) || qobject_cast<QDockWidget *>(parent)) {
+            break;
+        }
+        if (auto window = qobject_cast<QMainWindow *>(parent)) {
+            mainWindow = window;
+        }
+    }
+
+    if (mainWindow == nullptr || mainWindow != mainWindow->window()) {
+        return nullptr;
+    }
+    return mainWindow;
+}
+
 void ToolsAreaManager::doTranslucency(QMainWindow *win, bool on)
 {
     QVariant wasTranslucent = win->property("_helium_was_translucent");
@@ -206,47 +243,68 @@ bool ToolsAreaManager::eventFilter(QObject *watched, QEvent *event)
     Q_ASSERT(watched);
     Q_ASSERT(event);
 
-    QPointer<QObject> parent = watched;
-    QPointer<const QMainWindow> mainWindow = nullptr;
-    while (parent != nullptr) {
-        if (qobject_cast<QMainWindow *>(parent)) {
-            mainWindow = qobject_cast<QMainWindow *>(parent);
+    // the filter sits on main windows and their toolbars: check the event type before anything else
+    switch (event->type()) {
+    case QEvent::ChildAdded: {
+        const QMainWindow *mainWindow = qobject_cast<QMainWindow *>(watched);
+        if (!mainWindow) {
             break;
         }
-        parent = parent->parent();
+
+        QObject *child = static_cast<QChildEvent *>(event)->child();
+        if (QMenuBar *menuBar = qobject_cast<QMenuBar *>(child)) {
+            menuBar->setPalette(_palette);
+        } else if (QPointer<QToolBar> toolBar = qobject_cast<QToolBar *>(child)) {
+            if (mainWindow->toolBarArea(toolBar) == Qt::TopToolBarArea) {
+                appendIfNotAlreadyExists(mainWindow, toolBar);
+            }
+        }
+        break;
+    }
+
+    case QEvent::ChildRemoved: {
+        // removed children may already be partially destroyed, so look them up without casting
+        QObject *child = static_cast<QChildEvent *>(event)->child();
+        if (_toolBarWindows.value(child).data() == watched) {
+            const QPointer<const QMainWindow> window = _toolBarWindows.take(child);
+            removeWindowToolBar(window, qobject_cast<QToolBar *>(child));
+        }
+        break;
     }
 
-    if (const QMainWindow *mw = qobject_cast<QMainWindow *>(watched)) {
-        QChildEvent *ev = nullptr;
-        if (event->type() == QEvent::ChildAdded || event->type() == QEvent::ChildRemoved) {
-            ev = static_cast<QChildEvent *>(event);
+    case QEvent::ParentChange: {
+        // a toolbar was moved, or made floating: only follow it in the toolbar lists.
+        // The window is already shown, so its translucency is left alone unless the toolbar moved to another main window
+        QPointer<QToolBar> toolBar = qobject_cast<QToolBar *>(watched);
+        if (!toolBar) {
+            break;
+        }
 
-            if (event->type() == QEvent::ChildAdded) {
-                QChildEvent *childEvent = static_cast<QChildEvent *>(event);
-                if (QMenuBar *menuBar = qobject_cast<QMenuBar *>(childEvent->child())) {
-                    menuBar->setPalette(_palette);
-                }
-            }
-        } else {
-            return false;
+        const QPointer<const QMainWindow> previousWindow = _toolBarWindows.value(watched);
+        const QMainWindow *mainWindow = findMainWindow(toolBar);
+        if (previousWindow && previousWindow != mainWindow) {
+            removeWindowToolBar(previousWindow, toolBar);
         }
 
-        QPointer<QToolBar> tb = qobject_cast<QToolBar *>(ev->child());
-        if (tb.isNull()) {
-            return false;
+        if (!mainWindow) {
+            break;
         }
 
-        if (ev->added()) {
-            if (mw->toolBarArea(tb) == Qt::TopToolBarArea) {
-                appendIfNotAlreadyExists(mw, tb);
+        if (mainWindow->toolBarArea(toolBar) != Qt::TopToolBarArea) {
+            if (previousWindow == mainWindow) {
+                toolBar->setPalette(mainWindow->palette());
+                removeWindowToolBar(mainWindow, toolBar);
             }
-        } else if (ev->removed()) {
-            removeWindowToolBar(mw, tb);
-        }
-    } else if (qobject_cast<QToolBar *>(watched)) {
-        if (!mainWindow.isNull()) {
-            tryUnregisterToolBar(mainWindow, qobject_cast<QWidget *>(watched));
+        } else if (previousWindow == mainWindow) {
+            appendIfNotAlreadyExists(mainWindow, toolBar);
+        } else {
+            tryRegisterToolBar(mainWindow, toolBar.data());
         }
+        break;
+    }
+
+    default:
+        break;
     }
 
     return false;
@@ -269,26 +327,17 @@ void ToolsAreaManager::registerWidget(QWidget *widget)
             menuBar->setPalette(_palette);
         }
 
+        // catch toolbars and menubars added later on
+        widget->removeEventFilter(this);
+        widget->installEventFilter(this);
+
         return;
     }
 
-    auto parent = ptr;
-
-    while (parent != nullptr) {
-        if (qobject_cast<QMdiArea *>(parent) || qobject_cast<QDockWidget *>(parent)) {
-            break;
-        }
-        if (auto window = qobject_cast<QMainWindow *>(parent)) {
-            mainWindow = window;
-        }
-        parent = parent->parentWidget();
-    }
+    mainWindow = findMainWindow(widget);
     if (mainWindow == nullptr) {
         return;
     }
-    if (mainWindow.data() != mainWindow->window()) {
-        return;
-    }
     tryRegisterToolBar(mainWindow, widget);
 }
 
@@ -298,18 +347,13 @@ void ToolsAreaManager::unregisterWidget(QWidget *widget)
     auto ptr = QPointer<QWidget>(widget);
 
     if (QPointer<const QMainWindow> window = qobject_cast<QMainWindow *>(ptr)) {
+        widget->removeEventFilter(this);
         removeWindow(window);
         return;
     } else if (QPointer<QToolBar> toolbar = qobject_cast<QToolBar *>(ptr)) {
-        auto parent = ptr;
-        QPointer<const QMainWindow> mainWindow = nullptr;
-        while (parent != nullptr) {
-            if (qobject_cast<QMainWindow *>(parent)) {
-                mainWindow = qobject_cast<QMainWindow *>(parent);
-                break;
-            }
-            parent = parent->parentWidget();
-        }
+        widget->removeEventFilter(this);
+
+        const QPointer<const QMainWindow> mainWindow = _toolBarWindows.value(widget);
         if (mainWindow == nullptr) {
             return;
         }
@@ -3,6 +3,7 @@
 #include "breezehelper.h"
 #include "breezestyle.h"
 #include <KSharedConfig>
+#include <QHash>
 #include <QObject>
 
 namespace Breeze
@@ -22,6 +23,12 @@ private:
         QVector<QPointer<QToolBar>> toolBars;
     };
     std::vector<WindowToolBars> _windows;
+
+    //* main window of each registered toolbar, kept up to date from ChildAdded, ChildRemoved and ParentChange
+    QHash<const QObject *, QPointer<const QMainWindow>> _toolBarWindows;
+
+    //* number of parent chain walks done to find a main window
+    int _parentWalkCount = 0;
     QPalette _palette = QPalette();
     bool _colorSchemeHasHeaderColor;
     bool _translucent = false;
@@ -31,6 +38,9 @@ private:
     void removeWindowToolBar(const QMainWindow *window, const QPointer<QToolBar> &toolBar);
     void removeWindow(const QMainWindow *window);
 
+    //* top level main window of given widget, if not embedded in an mdi area or dock widget
+    const QMainWindow *findMainWindow(QWidget *widget);
+
     friend class AppListener;
 
 protected:
@@ -55,6 +65,12 @@ public:
 
     QRect toolsAreaRect(const QMainWindow &window) const;
 
+    //* number of parent chain walks done to find a main window, for diagnostics
+    int parentWalkCount() const
+    {
+        return _parentWalkCount;
+    }
+
     bool hasHeaderColors();
 
     // sets the translucency of a window for translucent tools area purposes
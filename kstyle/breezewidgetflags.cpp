@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "breezewidgetflags.h"
+#include "breezepropertynames.h"
+
+#include <QDynamicPropertyChangeEvent>
+
+namespace Breeze
+{
+
+//____________________________________________________________________
+WidgetFlags::WidgetFlags()
+    : QObject()
+{
+}
+
+//____________________________________________________________________
+void WidgetFlags::registerWidget(QWidget *widget)
+{
+    if (!widget || _flags.contains(widget)) {
+        return;
+    }
+
+    registerObject(widget);
+}
+
+//____________________________________________________________________
+void WidgetFlags::unregisterWidget(QWidget *widget)
+{
+    if (!widget || !_flags.remove(widget)) {
+        return;
+    }
+
+    widget->removeEventFilter(this);
+    disconnect(widget, &QObject::destroyed, this, &WidgetFlags::widgetDestroyed);
+}
+
+//____________________________________________________________________
+WidgetFlags::Flags WidgetFlags::flags(const QObject *object)
+{
+    if (!object) {
+        return Flags();
+    }
+
+    auto it = _flags.constFind(object);
+    if (it != _flags.constEnd()) {
+        return it.value();
+    }
+
+    // event filters cannot be installed across threads
+    if (object->thread() != thread()) {
+        return readFlags(object);
+    }
+
+    return registerObject(const_cast<QObject *>(object));
+}
+
+//____________________________________________________________________
+WidgetFlags::Flags WidgetFlags::registerObject(QObject *object)
+{
+    const Flags flags(readFlags(object));
+    _flags.insert(object, flags);
+
+    object->removeEventFilter(this);
+    object->installEventFilter(this);
+    connect(object, &QObject::destroyed, this, &WidgetFlags::widgetDestroyed, Qt::UniqueConnection);
+    return flags;
+}
+
+//____________________________________________________________________
+bool WidgetFlags::setAlteredBackground(const QWidget *widget, bool value)
+{
+    auto it = _flags.find(widget);
+    if (it == _flags.end()) {
+        return false;
+    }
+
+    if (!it.value().testFlag(HasAlteredBackground)) {
+        it.value() |= AlteredBackgroundResolved;
+        it.value().setFlag(AlteredBackground, value);
+    }
+    return true;
+}
+
+//____________________________________________________________________
+Qt::Edges WidgetFlags::bordersSides(Flags flags)
+{
+    Qt::Edges edges;
+    edges.setFlag(Qt::LeftEdge, flags.testFlag(BordersLeftEdge));
+    edges.setFlag(Qt::TopEdge, flags.testFlag(BordersTopEdge));
+    edges.setFlag(Qt::RightEdge, flags.testFlag(BordersRightEdge));
+    edges.setFlag(Qt::BottomEdge, flags.testFlag(BordersBottomEdge));
+    return edges;
+}
+
+//____________________________________________________________________
+bool WidgetFlags::eventFilter(QObject *object, QEvent *event)
+{
+    switch (event->type()) {
+    case QEvent::DynamicPropertyChange: {
+        auto it = _flags.find(object);
+        if (it == _flags.end()) {
+            break;
+        }
+
+        const QByteArray propertyName(static_cast<QDynamicPropertyChangeEvent *>(event)->propertyName());
+        if (propertyName == PropertyNames::alteredBackground && object->isWidgetType()) {
+            // children inherit the altered background
+            invalidateAlteredBackground(static_cast<QWidget *>(object));
+        }
+
+        // keep the computed altered background, which is not read from properties
+        const Flags resolved(it.value() & (AlteredBackgroundResolved | AlteredBackground));
+        it.value() = readFlags(object);
+        if (!it.value().testFlag(HasAlteredBackground)) {
+            it.value() |= resolved;
+        }
+        break;
+    }
+
+    case QEvent::ParentChange:
+        if (object->isWidgetType()) {
+            invalidateAlteredBackground(static_cast<QWidget *>(object));
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // never eat events
+    return false;
+}
+
+//____________________________________________________________________
+void WidgetFlags::widgetDestroyed(QObject *object)
+{
+    _flags.remove(object);
+}
+
+//____________________________________________________________________
+WidgetFlags::Flags WidgetFlags::readFlags(const QObject *object)
+{
+    Flags flags;
+    flags.setFlag(NoSeparator, object->property(PropertyNames::noSeparator).toBool());
+    flags.setFlag(HighlightNeutral, object->property(PropertyNames::highlightNeutral).toBool());
+    flags.setFlag(SidePanelView, object->property(PropertyNames::sidePanelView).toBool());
+
+    const QVariant forceFrame(object->property(PropertyNames::forceFrame));
+    if (forceFrame.isValid()) {
+        flags |= HasForceFrame;
+        flags.setFlag(ForceFrame, forceFrame.toBool());
+    }
+
+    const QVariant bordersSides(object->property(PropertyNames::bordersSides));
+    if (bordersSides.isValid()) {
+        flags |= HasBordersSides;
+        const auto edges(bordersSides.value<Qt::Edges>());
+        flags.setFlag(BordersLeftEdge, edges.testFlag(Qt::LeftEdge));
+        flags.setFlag(BordersTopEdge, edges.testFlag(Qt::TopEdge));
+        flags.setFlag(BordersRightEdge, edges.testFlag(Qt::RightEdge));
+        flags.setFlag(BordersBottomEdge, edges.testFlag(Qt::BottomEdge));
+    }
+
+    const QVariant alteredBackground(object->property(PropertyNames::alteredBackground));
+    if (alteredBackground.isValid()) {
+        flags |= HasAlteredBackground;
+        flags.setFlag(AlteredBackground, alteredBackground.toBool());
+    }
+
+    return flags;
+}
+
+//____________________________________________________________________
+void WidgetFlags::invalidateAlteredBackground(QWidget *widget)
+{
+    auto invalidate = [this](const QObject *object) {
+        auto it = _flags.find(object);
+        if (it != _flags.end() && !it.value().testFlag(HasAlteredBackground)) {
+            it.value() &= ~Flags(AlteredBackgroundResolved | AlteredBackground);
+        }
+    };
+
+    invalidate(widget);
+    const auto children = widget->findChildren<QWidget *>();
+    for (const QWidget *child : children) {
+        invalidate(child);
+    }
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#pragma once
+
+#include "breeze.h"
+
+#include <QEvent>
+#include <QHash>
+#include <QObject>
+#include <QWidget>
+
+namespace Breeze
+{
+
+//* style-owned side table of the per-widget style properties read in paint paths
+/**
+flags are read from the dynamic properties in PropertyNames when a widget is polished,
+or on first lookup for other objects such as Qt Quick style objects, and refreshed on DynamicPropertyChange, so that painting does not go through QObject::property
+*/
+class WidgetFlags : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Flag : quint32 {
+        NoSeparator = 1 << 0,
+        HighlightNeutral = 1 << 1,
+        SidePanelView = 1 << 2,
+
+        //* forceFrame property is set, with its value
+        HasForceFrame = 1 << 3,
+        ForceFrame = 1 << 4,
+
+        //* bordersSides property is set, with its edges
+        HasBordersSides = 1 << 5,
+        BordersLeftEdge = 1 << 6,
+        BordersTopEdge = 1 << 7,
+        BordersRightEdge = 1 << 8,
+        BordersBottomEdge = 1 << 9,
+
+        //* alteredBackground property is set, or AlteredBackgroundResolved. AlteredBackground holds the value
+        HasAlteredBackground = 1 << 10,
+        AlteredBackgroundResolved = 1 << 11,
+        AlteredBackground = 1 << 12,
+    };
+    Q_DECLARE_FLAGS(Flags, Flag)
+
+    //* constructor
+    explicit WidgetFlags();
+
+    //* register widget
+    void registerWidget(QWidget *);
+
+    //* unregister widget
+    void unregisterWidget(QWidget *);
+
+    //* flags for given object. Objects which are not registered, like Qt Quick style objects, are registered on first use
+    Flags flags(const QObject *);
+
+    //* store altered background as computed by the style, until the widget or one of its parents changes
+    /** returns false if the widget is not registered */
+    bool setAlteredBackground(const QWidget *, bool);
+
+    //* edges from bordersSides flags
+    static Qt::Edges bordersSides(Flags);
+
+    //* event filter
+    bool eventFilter(QObject *, QEvent *) override;
+
+protected Q_SLOTS:
+
+    //* triggered by object destruction
+    void widgetDestroyed(QObject *);
+
+private:
+    //* register object and track its property changes and destruction
+    Flags registerObject(QObject *);
+
+    //* read flags from properties
+    static Flags readFlags(const QObject *);
+
+    //* drop computed altered background of a widget and its children, which inherit it
+    void invalidateAlteredBackground(QWidget *);
+
+    //* flags of registered widgets and style objects
+    QHash<const QObject *, Flags> _flags;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(WidgetFlags::Flags)
+
+}
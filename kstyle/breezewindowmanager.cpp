@@ -171,12 +171,21 @@ void WindowManager::registerQuickItem(QQuickItem *item)
         return;
     }
 
-    if (auto window = item->window()) {
-        auto contentItem = window->contentItem();
-        contentItem->setAcceptedMouseButtons(Qt::LeftButton);
-        contentItem->removeEventFilter(this);
-        contentItem->installEventFilter(this);
+    auto window = item->window();
+    if (!window || _registeredQuickWindows.contains(window)) {
+        return;
     }
+
+    auto contentItem = window->contentItem();
+    contentItem->setAcceptedMouseButtons(Qt::LeftButton);
+    contentItem->removeEventFilter(this);
+    contentItem->installEventFilter(this);
+    ++_quickWindowFilterInstallCount;
+
+    _registeredQuickWindows.insert(window);
+    connect(window, &QObject::destroyed, this, [this, window]() {
+        _registeredQuickWindows.remove(window);
+    });
 }
 #endif
 
@@ -21,6 +21,7 @@
 
 #if BREEZE_HAVE_QTQUICK
 #include <QQuickItem>
+#include <QQuickWindow>
 #endif
 
 namespace Breeze
@@ -44,7 +45,20 @@ public:
 
 #if BREEZE_HAVE_QTQUICK
     //* register quick item
+    /** the event filter is installed once per QQuickWindow, on its content item */
     void registerQuickItem(QQuickItem *);
+
+    //* number of times the event filter got installed on a QQuickWindow content item
+    int quickWindowFilterInstallCount() const
+    {
+        return _quickWindowFilterInstallCount;
+    }
+
+    //* number of live QQuickWindows with the event filter installed on their content item
+    int quickWindowRegistrationCount() const
+    {
+        return _registeredQuickWindows.size();
+    }
 #endif
 
     //* unregister widget
@@ -253,6 +267,13 @@ private:
 
 #if BREEZE_HAVE_QTQUICK
     WeakPointer<QQuickItem> _quickTarget;
+
+    //* quick windows whose content item has the event filter installed
+    /** entries are removed when the window is destroyed */
+    QSet<const QQuickWindow *> _registeredQuickWindows;
+
+    //* number of event filter installations on quick windows
+    int _quickWindowFilterInstallCount = 0;
 #endif
 
     //* true if drag is about to start
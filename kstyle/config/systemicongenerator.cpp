@@ -6,6 +6,7 @@
 
 #include "systemicongenerator.h"
 #include "renderdecorationbuttonicon.h"
+#include "tracing.h"
 #include <KLocalizedString>
 #include <KSharedConfig>
 #include <QApplication>
@@ -30,6 +31,8 @@ SystemIconGenerator::SystemIconGenerator(InternalSettingsPtr internalSettings)
 
 void SystemIconGenerator::generate()
 {
+    HELIUM_TRACE_SCOPE("icons", "SystemIconGenerator::generate");
+
     if (m_internalSettings->buttonIconStyle() == InternalSettings::EnumButtonIconStyle::StyleSystemIconTheme) {
         return;
     }
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "colortools.h"
+#include "decorationbuttoncolors.h"
+
+#include <KColorUtils>
+
+#include <QTest>
+#include <QtMath>
+
+using namespace Breeze;
+
+class DecorationButtonColorsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testRamp_data();
+    void testRamp();
+
+    void benchmarkMix();
+    void benchmarkRamp();
+};
+
+//* colour of an animation frame, as mixed on every paint before the ramps were introduced
+static QColor mixedColor(const QColor &from, const QColor &to, const bool fadeOutFrom, const qreal progress)
+{
+    if (from.isValid() && to.isValid()) {
+        return KColorUtils::mix(from, to, progress);
+    } else if (to.isValid()) {
+        return ColorTools::alphaMix(to, progress);
+    } else if (from.isValid() && fadeOutFrom) {
+        return ColorTools::alphaMix(from, 1.0 - progress);
+    } else {
+        return QColor();
+    }
+}
+
+//* progress of the frames of a 150 ms animation at 60 frames per second
+static QList<qreal> frameProgresses()
+{
+    QList<qreal> progresses;
+    for (int frame = 0; frame <= 9; ++frame) {
+        progresses.append(frame / 9.0);
+    }
+    return progresses;
+}
+
+//____________________________________________________________________
+void DecorationButtonColorsTest::testRamp_data()
+{
+    QTest::addColumn<QColor>("from");
+    QTest::addColumn<QColor>("to");
+    QTest::addColumn<bool>("fadeOutFrom");
+
+    const QColor normal(40, 120, 200, 255);
+    const QColor hover(230, 80, 60, 180);
+
+    QTest::newRow("both valid") << normal << hover << false;
+    QTest::newRow("both valid, fade out") << normal << hover << true;
+    QTest::newRow("fade in") << QColor() << hover << false;
+    QTest::newRow("fade out") << normal << QColor() << true;
+    QTest::newRow("no fade out") << normal << QColor() << false;
+    QTest::newRow("both invalid") << QColor() << QColor() << true;
+}
+
+//____________________________________________________________________
+void DecorationButtonColorsTest::testRamp()
+{
+    QFETCH(QColor, from);
+    QFETCH(QColor, to);
+    QFETCH(bool, fadeOutFrom);
+
+    DecorationButtonColorRamp ramp;
+    ramp.generate(from, to, fadeOutFrom);
+
+    // the ends of the ramp are exact
+    QCOMPARE(ramp.at(0), mixedColor(from, to, fadeOutFrom, 0));
+    QCOMPARE(ramp.at(1), mixedColor(from, to, fadeOutFrom, 1));
+    if (from.isValid() && to.isValid()) {
+        QCOMPARE(ramp.at(0), from);
+        QCOMPARE(ramp.at(1), to);
+    }
+
+    // progress out of range is clamped
+    QCOMPARE(ramp.at(-0.5), ramp.at(0));
+    QCOMPARE(ramp.at(1.5), ramp.at(1));
+
+    // intermediate frames are within one step of the mixed colour
+    const int tolerance = qCeil(255.0 / DecorationButtonColorRamp::steps);
+    const auto progresses = frameProgresses();
+    for (const qreal progress : progresses) {
+        const QColor expected = mixedColor(from, to, fadeOutFrom, progress);
+        const QColor actual = ramp.at(progress);
+        QCOMPARE(actual.isValid(), expected.isValid());
+        if (!expected.isValid()) {
+            continue;
+        }
+
+        QVERIFY2(qAbs(actual.red() - expected.red()) <= tolerance, qPrintable(QString::number(progress)));
+        QVERIFY2(qAbs(actual.green() - expected.green()) <= tolerance, qPrintable(QString::number(progress)));
+        QVERIFY2(qAbs(actual.blue() - expected.blue()) <= tolerance, qPrintable(QString::number(progress)));
+        QVERIFY2(qAbs(actual.alpha() - expected.alpha()) <= tolerance, qPrintable(QString::number(progress)));
+    }
+}
+
+//____________________________________________________________________
+void DecorationButtonColorsTest::benchmarkMix()
+{
+    const QColor normal(40, 120, 200, 255);
+    const QColor hover(230, 80, 60, 180);
+    const auto progresses = frameProgresses();
+
+    QColor color;
+    QBENCHMARK {
+        for (const qreal progress : progresses) {
+            color = mixedColor(normal, hover, false, progress);
+        }
+    }
+    QVERIFY(color.isValid());
+}
+
+//____________________________________________________________________
+void DecorationButtonColorsTest::benchmarkRamp()
+{
+    const QColor normal(40, 120, 200, 255);
+    const QColor hover(230, 80, 60, 180);
+    const auto progresses = frameProgresses();
+
+    DecorationButtonColorRamp ramp;
+    ramp.generate(normal, hover, false);
+
+    QColor color;
+    QBENCHMARK {
+        for (const qreal progress : progresses) {
+            color = ramp.at(progress);
+        }
+    }
+    QVERIFY(color.isValid());
+}
+
+QTEST_GUILESS_MAIN(DecorationButtonColorsTest)
+
+#include "decorationbuttoncolorstest.moc"
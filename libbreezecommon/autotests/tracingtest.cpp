@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "tracing.h"
+
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSet>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThread>
+
+#include <memory>
+
+using namespace Breeze;
+
+class TracingTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void testTwoThreads();
+
+private:
+    QTemporaryDir _dir;
+};
+
+//* number of scopes recorded by each thread
+static constexpr int scopeCount = 100;
+
+//____________________________________________________________________
+void TracingTest::initTestCase()
+{
+    QVERIFY(_dir.isValid());
+
+    // read once, when the first scope is recorded
+    qputenv("HELIUM_TRACE_FILE", _dir.filePath(QStringLiteral("trace-%p.json")).toLocal8Bit());
+}
+
+//____________________________________________________________________
+void TracingTest::testTwoThreads()
+{
+    QVERIFY(Tracer::enabled());
+
+    auto record = [](bool first) {
+        for (int i = 0; i < scopeCount; ++i) {
+            if (first) {
+                HELIUM_TRACE_SCOPE("test", "first");
+            } else {
+                HELIUM_TRACE_SCOPE("test", "second");
+            }
+        }
+    };
+
+    std::unique_ptr<QThread> firstThread(QThread::create(record, true));
+    std::unique_ptr<QThread> secondThread(QThread::create(record, false));
+    firstThread->start();
+    secondThread->start();
+    QVERIFY(firstThread->wait());
+    QVERIFY(secondThread->wait());
+
+    Tracer::flush();
+
+    // "%p" is replaced with the process id
+    QFile file(_dir.filePath(QStringLiteral("trace-%1.json").arg(QCoreApplication::applicationPid())));
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QVERIFY(document.isObject());
+
+    const QJsonArray events = document.object().value(QStringLiteral("traceEvents")).toArray();
+    QCOMPARE(events.size(), 2 * scopeCount);
+
+    QHash<QString, int> counts;
+    QHash<QString, QSet<qint64>> threads;
+    for (const QJsonValue &value : events) {
+        const QJsonObject event = value.toObject();
+        QCOMPARE(event.value(QStringLiteral("cat")).toString(), QStringLiteral("test"));
+        QCOMPARE(event.value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+        QCOMPARE(event.value(QStringLiteral("pid")).toInteger(), QCoreApplication::applicationPid());
+        QVERIFY(event.value(QStringLiteral("dur")).toDouble() >= 0);
+
+        const QString name = event.value(QStringLiteral("name")).toString();
+        ++counts[name];
+        threads[name].insert(event.value(QStringLiteral("tid")).toInteger());
+    }
+
+    QCOMPARE(counts.value(QStringLiteral("first")), scopeCount);
+    QCOMPARE(counts.value(QStringLiteral("second")), scopeCount);
+
+    // each thread records under its own id
+    QCOMPARE(threads.value(QStringLiteral("first")).size(), 1);
+    QCOMPARE(threads.value(QStringLiteral("second")).size(), 1);
+    QVERIFY(threads.value(QStringLiteral("first")) != threads.value(QStringLiteral("second")));
+}
+
+QTEST_GUILESS_MAIN(TracingTest)
+
+#include "tracingtest.moc"
@@ -0,0 +1,340 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "buttonicongeometryplan.h"
+
+#include <QCache>
+#include <QPaintEngine>
+
+#include <climits>
+
+namespace Breeze
+{
+
+bool ButtonIconGeometryPlanKey::operator==(const ButtonIconGeometryPlanKey &other) const
+{
+    return iconStyle == other.iconStyle && buttonType == other.buttonType && checked == other.checked && fromKstyle == other.fromKstyle
+        && boldButtonIcons == other.boldButtonIcons && forceEvenSquares == other.forceEvenSquares && strokeToFilledPath == other.strokeToFilledPath
+        && cosmeticPen == other.cosmeticPen && penStyle == other.penStyle && penAlpha == other.penAlpha && renderHints == other.renderHints
+        && penWidth == other.penWidth && devicePixelRatio == other.devicePixelRatio && deviceOffsetFromZeroReference == other.deviceOffsetFromZeroReference
+        && m11 == other.m11 && m12 == other.m12 && m21 == other.m21 && m22 == other.m22;
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const ButtonIconGeometryPlanKey &key, size_t seed)
+#else
+uint qHash(const ButtonIconGeometryPlanKey &key, uint seed)
+#endif
+{
+    // adding 0.0 folds -0.0 into 0.0 so that keys comparing equal hash equally
+    const qreal reals[] = {key.penWidth + 0.0,
+                           key.devicePixelRatio + 0.0,
+                           key.deviceOffsetFromZeroReference.x() + 0.0,
+                           key.deviceOffsetFromZeroReference.y() + 0.0,
+                           key.m11 + 0.0,
+                           key.m12 + 0.0,
+                           key.m21 + 0.0,
+                           key.m22 + 0.0};
+    const int ints[] = {key.iconStyle,
+                        key.buttonType,
+                        key.penStyle,
+                        key.penAlpha,
+                        key.renderHints,
+                        int(key.checked) | int(key.fromKstyle) << 1 | int(key.boldButtonIcons) << 2 | int(key.forceEvenSquares) << 3
+                            | int(key.strokeToFilledPath) << 4 | int(key.cosmeticPen) << 5};
+    return qHashBits(ints, sizeof(ints), qHashBits(reals, sizeof(reals), seed));
+}
+
+void ButtonIconGeometryPlan::replay(QPainter *painter) const
+{
+    if (m_primitives.isEmpty()) {
+        return;
+    }
+
+    // icons only ever derive their colours from the pen colour, by changing its alpha
+    const QColor color(painter->pen().color());
+    auto recolor = [&color](const QColor &recorded) -> QColor {
+        QColor c(color);
+        c.setAlphaF(recorded.alphaF());
+        return c;
+    };
+
+    painter->save();
+    const QTransform baseTransform(painter->worldTransform());
+    const qreal baseOpacity(painter->opacity());
+    const QPainter::CompositionMode baseCompositionMode(painter->compositionMode());
+
+    for (const Primitive &primitive : m_primitives) {
+        if (primitive.clipEnabled) {
+            painter->save();
+            painter->setWorldTransform(baseTransform);
+            painter->setClipPath(primitive.clipPath, Qt::IntersectClip);
+        }
+
+        QPen pen(primitive.pen);
+        if (pen.style() != Qt::NoPen) {
+            pen.setColor(recolor(pen.color()));
+        }
+
+        QBrush brush(primitive.brush);
+        if (brush.style() != Qt::NoBrush) {
+            brush.setColor(recolor(brush.color()));
+        }
+
+        painter->setWorldTransform(primitive.transform * baseTransform);
+        painter->setOpacity(baseOpacity * primitive.opacity);
+        painter->setRenderHints(primitive.renderHints);
+        painter->setCompositionMode(primitive.compositionMode == QPainter::CompositionMode_SourceOver ? baseCompositionMode : primitive.compositionMode);
+        painter->setPen(pen);
+        painter->setBrush(brush);
+        painter->drawPath(primitive.path);
+
+        if (primitive.clipEnabled) {
+            painter->restore();
+        }
+    }
+
+    painter->restore();
+}
+
+//* paint engine collecting primitives, in device coordinates
+class ButtonIconGeometryPlanRecorder::Engine : public QPaintEngine
+{
+public:
+    Engine()
+        : QPaintEngine(QPaintEngine::AllFeatures)
+    {
+    }
+
+    bool begin(QPaintDevice *) override
+    {
+        return true;
+    }
+
+    bool end() override
+    {
+        return true;
+    }
+
+    Type type() const override
+    {
+        return QPaintEngine::User;
+    }
+
+    void updateState(const QPaintEngineState &state) override
+    {
+        const QPaintEngine::DirtyFlags flags(state.state());
+
+        if (flags & DirtyPen) {
+            m_pen = state.pen();
+        }
+        if (flags & DirtyBrush) {
+            m_brush = state.brush();
+        }
+        if (flags & DirtyTransform) {
+            m_transform = state.transform();
+        }
+        if (flags & DirtyOpacity) {
+            m_opacity = state.opacity();
+        }
+        if (flags & DirtyHints) {
+            m_renderHints = state.renderHints();
+        }
+        if (flags & DirtyCompositionMode) {
+            m_compositionMode = state.compositionMode();
+        }
+
+        if (flags & (DirtyClipPath | DirtyClipRegion)) {
+            QPainterPath clip;
+            if (flags & DirtyClipPath) {
+                clip = state.clipPath();
+            } else {
+                clip.addRegion(state.clipRegion());
+            }
+            clip = m_transform.map(clip);
+
+            switch (state.clipOperation()) {
+            case Qt::NoClip:
+                m_clipEnabled = false;
+                m_clipPath = QPainterPath();
+                break;
+            case Qt::ReplaceClip:
+                m_clipEnabled = true;
+                m_clipPath = clip;
+                break;
+            case Qt::IntersectClip:
+                m_clipPath = m_clipEnabled ? m_clipPath.intersected(clip) : clip;
+                m_clipEnabled = true;
+                break;
+            }
+        }
+        if (flags & DirtyClipEnabled) {
+            m_clipEnabled = state.isClipEnabled();
+        }
+    }
+
+    void drawPath(const QPainterPath &path) override
+    {
+        record(path, m_brush);
+    }
+
+    void drawPolygon(const QPointF *points, int pointCount, PolygonDrawMode mode) override
+    {
+        if (pointCount <= 0) {
+            return;
+        }
+
+        QPainterPath path(points[0]);
+        for (int i = 1; i < pointCount; ++i) {
+            path.lineTo(points[i]);
+        }
+
+        if (mode == PolylineMode) {
+            record(path, Qt::NoBrush);
+        } else {
+            path.closeSubpath();
+            path.setFillRule(mode == OddEvenMode ? Qt::OddEvenFill : Qt::WindingFill);
+            record(path, m_brush);
+        }
+    }
+
+    void drawPixmap(const QRectF &, const QPixmap &, const QRectF &) override
+    {
+        m_valid = false;
+    }
+
+    void drawImage(const QRectF &, const QImage &, const QRectF &, Qt::ImageConversionFlags) override
+    {
+        m_valid = false;
+    }
+
+    void record(const QPainterPath &path, const QBrush &brush)
+    {
+        // only flat colours can be recoloured on replay
+        if ((brush.style() != Qt::NoBrush && brush.style() != Qt::SolidPattern)
+            || (m_pen.style() != Qt::NoPen && m_pen.brush().style() != Qt::SolidPattern)) {
+            m_valid = false;
+            return;
+        }
+
+        ButtonIconGeometryPlan::Primitive primitive;
+        primitive.path = path;
+        primitive.pen = m_pen;
+        primitive.brush = brush;
+        primitive.transform = m_transform;
+        primitive.opacity = m_opacity;
+        primitive.renderHints = m_renderHints;
+        primitive.compositionMode = m_compositionMode;
+        primitive.clipEnabled = m_clipEnabled;
+        primitive.clipPath = m_clipPath;
+        m_primitives.append(primitive);
+    }
+
+    bool m_valid = true;
+    QVector<ButtonIconGeometryPlan::Primitive> m_primitives;
+
+private:
+    QPen m_pen;
+    QBrush m_brush;
+    QTransform m_transform;
+    qreal m_opacity = 1;
+    QPainter::RenderHints m_renderHints;
+    QPainter::CompositionMode m_compositionMode = QPainter::CompositionMode_SourceOver;
+    bool m_clipEnabled = false;
+    QPainterPath m_clipPath;
+};
+
+ButtonIconGeometryPlanRecorder::ButtonIconGeometryPlanRecorder(const QTransform &deviceTransform)
+    : m_engine(new Engine)
+    , m_inverseDeviceTransform(deviceTransform.inverted(&m_invertible))
+{
+}
+
+ButtonIconGeometryPlanRecorder::~ButtonIconGeometryPlanRecorder()
+{
+    delete m_engine;
+}
+
+QPaintEngine *ButtonIconGeometryPlanRecorder::paintEngine() const
+{
+    return m_engine;
+}
+
+bool ButtonIconGeometryPlanRecorder::isValid() const
+{
+    return m_invertible && m_engine->m_valid;
+}
+
+ButtonIconGeometryPlan ButtonIconGeometryPlanRecorder::takePlan()
+{
+    ButtonIconGeometryPlan plan;
+    if (!isValid()) {
+        return plan;
+    }
+
+    // make the primitives relative to the device transform, so that the plan can be replayed at any position
+    plan.m_primitives = std::move(m_engine->m_primitives);
+    for (ButtonIconGeometryPlan::Primitive &primitive : plan.m_primitives) {
+        primitive.transform = primitive.transform * m_inverseDeviceTransform;
+        if (primitive.clipEnabled) {
+            primitive.clipPath = m_inverseDeviceTransform.map(primitive.clipPath);
+        }
+    }
+
+    m_engine->m_primitives.clear();
+    return plan;
+}
+
+int ButtonIconGeometryPlanRecorder::metric(PaintDeviceMetric metric) const
+{
+    switch (metric) {
+    case PdmWidth:
+    case PdmHeight:
+        return 1024;
+    case PdmWidthMM:
+    case PdmHeightMM:
+        return 271;
+    case PdmNumColors:
+        return INT_MAX;
+    case PdmDepth:
+        return 32;
+    case PdmDpiX:
+    case PdmDpiY:
+    case PdmPhysicalDpiX:
+    case PdmPhysicalDpiY:
+        return 96;
+    default:
+        return QPaintDevice::metric(metric);
+    }
+}
+
+namespace ButtonIconGeometryPlanCache
+{
+
+//* maximum number of compiled plans
+static constexpr int maxPlans = 512;
+
+// button icons are only rendered from the GUI thread of each process, but keep one cache per thread to stay safe with off-screen rendering
+static QCache<ButtonIconGeometryPlanKey, ButtonIconGeometryPlan> &cache()
+{
+    static thread_local QCache<ButtonIconGeometryPlanKey, ButtonIconGeometryPlan> s_cache(maxPlans);
+    return s_cache;
+}
+
+const ButtonIconGeometryPlan *find(const ButtonIconGeometryPlanKey &key)
+{
+    return cache().object(key);
+}
+
+const ButtonIconGeometryPlan *insert(const ButtonIconGeometryPlanKey &key, const ButtonIconGeometryPlan &plan)
+{
+    ButtonIconGeometryPlan *cachedPlan(new ButtonIconGeometryPlan(plan));
+    cache().insert(key, cachedPlan);
+    return cachedPlan;
+}
+}
+
+}
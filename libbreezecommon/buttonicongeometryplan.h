@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breeze.h"
+#include "breezecommon_export.h"
+
+#include <QBrush>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPen>
+#include <QTransform>
+#include <QVector>
+
+namespace Breeze
+{
+
+/**
+ * @brief Identifies a compiled button icon: everything that influences pixel snapping and stroke geometry in RenderDecorationButtonIcon.
+ *        The pen colour is deliberately not part of the key, only its alpha, as icons only ever derive their colours from the pen colour.
+ */
+struct ButtonIconGeometryPlanKey {
+    int iconStyle = -1;
+    int buttonType = 0;
+    bool checked = false;
+    bool fromKstyle = false;
+    bool boldButtonIcons = false;
+    bool forceEvenSquares = false;
+    bool strokeToFilledPath = false;
+    bool cosmeticPen = false;
+    int penStyle = 0;
+    int penAlpha = 0;
+    int renderHints = 0;
+    qreal penWidth = 0;
+    qreal devicePixelRatio = 1;
+    QPointF deviceOffsetFromZeroReference;
+    //* linear part of the device transform. The translation is not part of the key, as it is applied on replay
+    qreal m11 = 1;
+    qreal m12 = 0;
+    qreal m21 = 0;
+    qreal m22 = 1;
+
+    bool operator==(const ButtonIconGeometryPlanKey &other) const;
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+size_t qHash(const ButtonIconGeometryPlanKey &, size_t seed = 0);
+#else
+uint qHash(const ButtonIconGeometryPlanKey &, uint seed = 0);
+#endif
+
+/**
+ * @brief A button icon compiled into a flat list of already snapped primitives.
+ *        Plans are recorded by running a renderer against a recording paint device, and replayed onto any painter whose device transform
+ *        has the same linear part as the one used for recording.
+ */
+class ButtonIconGeometryPlan
+{
+public:
+    struct Primitive {
+        QPainterPath path;
+        QPen pen;
+        QBrush brush;
+        //* transform relative to the device transform at the time of recording
+        QTransform transform;
+        qreal opacity = 1;
+        QPainter::RenderHints renderHints;
+        QPainter::CompositionMode compositionMode = QPainter::CompositionMode_SourceOver;
+        //* clip path, relative to the device transform at the time of recording
+        bool clipEnabled = false;
+        QPainterPath clipPath;
+    };
+
+    //* replay the plan onto the given painter, recolouring primitives with the painter's pen colour
+    void replay(QPainter *) const;
+
+private:
+    QVector<Primitive> m_primitives;
+
+    friend class ButtonIconGeometryPlanRecorder;
+};
+
+/**
+ * @brief Paint device recording everything painted onto it as a ButtonIconGeometryPlan
+ */
+class ButtonIconGeometryPlanRecorder : public QPaintDevice
+{
+public:
+    /**
+     * @param deviceTransform The device transform of the painter the plan will be replayed on. Should be set as the world transform of the recording
+     * painter, so that renderers see the same scaling as when painting directly
+     */
+    explicit ButtonIconGeometryPlanRecorder(const QTransform &deviceTransform);
+    ~ButtonIconGeometryPlanRecorder() override;
+
+    QPaintEngine *paintEngine() const override;
+
+    //* true if everything painted could be recorded. Plans using pixmaps or gradients are not supported
+    bool isValid() const;
+
+    //* the recorded plan
+    ButtonIconGeometryPlan takePlan();
+
+protected:
+    int metric(PaintDeviceMetric) const override;
+
+private:
+    class Engine;
+    Engine *m_engine;
+    bool m_invertible = false;
+    QTransform m_inverseDeviceTransform;
+};
+
+/**
+ * @brief Process-wide LRU cache of compiled button icon plans
+ */
+namespace ButtonIconGeometryPlanCache
+{
+//* returns the plan for the given key, or nullptr if it has not been compiled yet
+const ButtonIconGeometryPlan *find(const ButtonIconGeometryPlanKey &);
+
+//* stores a compiled plan, and returns a pointer to the cached copy
+const ButtonIconGeometryPlan *insert(const ButtonIconGeometryPlanKey &, const ButtonIconGeometryPlan &);
+}
+
+}
@@ -5,6 +5,7 @@
  */
 #include "decorationbuttoncolors.h"
 #include "colortools.h"
+#include "tracing.h"
 #include <KColorUtils>
 #include <QJsonArray>
 #include <QJsonDocument>
@@ -27,6 +28,8 @@ void DecorationButtonPalette::generate(InternalSettingsPtr decorationSettings,
                                        const bool generateOneGroupOnly,
                                        const bool oneGroupActiveState)
 {
+    HELIUM_TRACE_SCOPE("colors", "DecorationButtonPalette::generate");
+
     _decorationSettings = decorationSettings;
     _decorationColorsActive = decorationColorsActive;
     _decorationColorsInactive = decorationColorsInactive;
@@ -44,6 +47,48 @@ void DecorationButtonPalette::generate(InternalSettingsPtr decorationSettings,
         generateButtonForegroundPalette(false);
         generateButtonOutlinePalette(false);
     }
+
+    generateColorRamps();
+}
+
+void DecorationButtonPalette::generateColorRamps()
+{
+    for (DecorationButtonPaletteGroup *group : {_active.get(), _inactive.get()}) {
+        group->foregroundHoverRamp.generate(group->foregroundNormal, group->foregroundHover, false);
+        group->backgroundHoverRamp.generate(group->backgroundNormal, group->backgroundHover, false);
+        group->outlineHoverRamp.generate(group->outlineNormal, group->outlineHover, false);
+    }
+
+    const std::array<QColor DecorationButtonPaletteGroup::*, static_cast<int>(OverridableButtonColorState::COUNT)> colors{
+        &DecorationButtonPaletteGroup::foregroundNormal,
+        &DecorationButtonPaletteGroup::foregroundHover,
+        &DecorationButtonPaletteGroup::foregroundPress,
+        &DecorationButtonPaletteGroup::backgroundNormal,
+        &DecorationButtonPaletteGroup::backgroundHover,
+        &DecorationButtonPaletteGroup::backgroundPress,
+        &DecorationButtonPaletteGroup::outlineNormal,
+        &DecorationButtonPaletteGroup::outlineHover,
+        &DecorationButtonPaletteGroup::outlinePress,
+    };
+    for (size_t i = 0; i < colors.size(); i++) {
+        _activeStateRamps[i].generate(_inactive.get()->*colors[i], _active.get()->*colors[i], true);
+    }
+}
+
+void DecorationButtonColorRamp::generate(const QColor &from, const QColor &to, const bool fadeOutFrom)
+{
+    for (int i = 0; i <= steps; i++) {
+        const qreal progress = qreal(i) / steps;
+        if (from.isValid() && to.isValid()) {
+            _colors[i] = KColorUtils::mix(from, to, progress);
+        } else if (to.isValid()) {
+            _colors[i] = ColorTools::alphaMix(to, progress);
+        } else if (from.isValid() && fadeOutFrom) {
+            _colors[i] = ColorTools::alphaMix(from, 1.0 - progress);
+        } else {
+            _colors[i] = QColor();
+        }
+    }
 }
 
 void DecorationButtonPalette::decodeButtonOverrideColors(const bool active)
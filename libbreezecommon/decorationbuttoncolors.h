@@ -11,6 +11,7 @@
 #include "decorationcolors.h"
 #include <KColorScheme>
 #include <QColor>
+#include <array>
 #include <memory>
 
 namespace Breeze
@@ -102,6 +103,33 @@ const QStringList overrideColorItems{
     QStringLiteral("WindowShadowInactive"),
 };
 
+/**
+ *  @brief Colours interpolated in fixed steps between two button palette colours, so that animation frames read a table rather than mixing colours
+ */
+class BREEZECOMMON_EXPORT DecorationButtonColorRamp
+{
+public:
+    //* number of steps between the two ends of the ramp
+    static constexpr int steps = 32;
+
+    /**
+     * @brief Fills the ramp. Invalid colours are faded in or out through their alpha, like the animations in Button do
+     * @param from The colour at progress 0
+     * @param to The colour at progress 1
+     * @param fadeOutFrom When only from is valid, fade it out rather than leaving the ramp invalid
+     */
+    void generate(const QColor &from, const QColor &to, const bool fadeOutFrom);
+
+    //* the colour at the given progress, between 0 and 1
+    QColor at(const qreal progress) const
+    {
+        return _colors[qBound(0, qRound(progress * steps), steps)];
+    }
+
+private:
+    std::array<QColor, steps + 1> _colors;
+};
+
 struct BREEZECOMMON_EXPORT DecorationButtonPaletteGroup {
     QColor foregroundPress;
     QColor foregroundHover;
@@ -120,6 +148,11 @@ struct BREEZECOMMON_EXPORT DecorationButtonPaletteGroup {
     QColor outlinePress;
     QColor outlineHover;
     QColor outlineNormal;
+
+    //* hover animation ramps, from the normal to the hover colour
+    DecorationButtonColorRamp foregroundHoverRamp;
+    DecorationButtonColorRamp backgroundHoverRamp;
+    DecorationButtonColorRamp outlineHoverRamp;
 };
 
 /**
@@ -149,6 +182,12 @@ public:
         return _buttonType;
     }
 
+    //* active state change animation ramp for the given state, from the inactive to the active colour
+    const DecorationButtonColorRamp &activeStateRamp(OverridableButtonColorState state) const
+    {
+        return _activeStateRamps[static_cast<int>(state)];
+    }
+
     static QColor overrideColorItemsIndexToColor(const DecorationPaletteGroup *decorationColorsActive,
                                                  const DecorationPaletteGroup *decorationColorsInactive,
                                                  const int overrideColorItemsIndex,
@@ -178,6 +217,9 @@ private:
                                       const DecorationPaletteGroup *decorationColorGroup);
     void generateButtonOutlinePalette(const bool active);
 
+    //* fills the animation ramps from both generated groups
+    void generateColorRamps();
+
     InternalSettingsPtr _decorationSettings;
     DecorationButtonType _buttonType;
     const DecorationPaletteGroup *_decorationColorsActive;
@@ -191,6 +233,8 @@ private:
 
     std::shared_ptr<DecorationButtonPaletteGroup> _active;
     std::shared_ptr<DecorationButtonPaletteGroup> _inactive;
+
+    std::array<DecorationButtonColorRamp, static_cast<int>(OverridableButtonColorState::COUNT)> _activeStateRamps;
 };
 
 }
@@ -5,6 +5,7 @@
  */
 #include "decorationcolors.h"
 #include "colortools.h"
+#include "tracing.h"
 #include <KColorUtils>
 #include <KStatefulBrush>
 
@@ -72,6 +73,8 @@ void DecorationColors::generateDecorationColors(const QPalette &palette,
                                                 const bool generateOneGroupOnly,
                                                 const bool oneGroupActiveState)
 {
+    HELIUM_TRACE_SCOPE("colors", "DecorationColors::generateDecorationColors");
+
     *m_basePalette = palette;
     if (m_useCachedPalette && !settingsUpdateUuid.isEmpty()) { // m_settingsUpdateUuid must only be accessed/modified when m_useCachedPalette is true
         *static_cast<QByteArray *>(m_settingsUpdateUuid) = settingsUpdateUuid;
@@ -98,6 +101,8 @@ void DecorationColors::generateDecorationAndButtonColors(const QPalette &palette
                                                          const bool generateOneGroupOnly,
                                                          const bool oneGroupActiveState)
 {
+    HELIUM_TRACE_SCOPE("colors", "DecorationColors::generateDecorationAndButtonColors");
+
     generateDecorationColors(palette,
                              decorationSettings,
                              titleBarTextActive,
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "presetsindex.h"
+#include "presetsmodel.h"
+
+#include <KConfigGroup>
+
+namespace Breeze
+{
+
+//______________________________________________________________
+void PresetsIndex::rebuild(KConfig *presetsConfig)
+{
+    invalidate();
+    if (!presetsConfig) {
+        return;
+    }
+
+    // parse through a scratch InternalSettings, so that values are read exactly as PresetsModel::loadPreset would read them
+    auto parser = InternalSettingsPtr(new InternalSettings());
+    const KConfigSkeletonItem::List items = parser->items();
+    m_itemCount = items.count();
+
+    KCoreConfigSkeleton::ItemEnum *borderSizeItem = static_cast<KCoreConfigSkeleton::ItemEnum *>(parser->findItem(QStringLiteral("BorderSize")));
+    m_borderSizeItemIndex = items.indexOf(borderSizeItem);
+
+    for (const QString &presetName : PresetsModel::readPresetsList(presetsConfig)) {
+        const QString groupName = PresetsModel::presetGroupName(presetName);
+
+        Preset preset;
+        preset.values.resize(m_itemCount);
+        for (int i = 0; i < m_itemCount; i++) {
+            KConfigSkeletonItem *item = items[i];
+            QString originalGroup = item->group();
+            if (originalGroup == QStringLiteral("Exceptions") || originalGroup == QStringLiteral("Global")) {
+                continue;
+            }
+            item->setGroup(groupName);
+            item->readConfig(presetsConfig);
+            item->setGroup(originalGroup);
+            preset.values[i] = item->property();
+        }
+
+        KConfigGroup configGroup = presetsConfig->group(groupName);
+        if (configGroup.hasKey(QStringLiteral("KwinBorderSize"))) {
+            preset.hasKwinBorderSize = true;
+            if (borderSizeItem) {
+                const QString kwinBorderSize(configGroup.readEntry(QStringLiteral("KwinBorderSize")));
+                const auto choiceList = borderSizeItem->choices();
+                for (int i = 0; i < choiceList.count(); i++) { // need to convert the string value of the enum value to an int for compatibility
+                    if (choiceList[i].name == kwinBorderSize)
+                        preset.kwinBorderSize = i;
+                }
+            }
+        }
+
+        m_presets.insert(presetName, preset);
+    }
+
+    m_valid = true;
+}
+
+//______________________________________________________________
+void PresetsIndex::invalidate()
+{
+    m_valid = false;
+    m_itemCount = 0;
+    m_borderSizeItemIndex = -1;
+    m_presets.clear();
+}
+
+//______________________________________________________________
+bool PresetsIndex::isPresetPresent(const QString &presetName) const
+{
+    return m_presets.contains(presetName);
+}
+
+//______________________________________________________________
+bool PresetsIndex::loadPreset(KCoreConfigSkeleton *skeleton, const QString &presetName) const
+{
+    auto it = m_presets.constFind(presetName);
+    if (it == m_presets.constEnd()) {
+        return false;
+    }
+
+    // values are only aligned with InternalSettings items
+    const KConfigSkeletonItem::List items = skeleton->items();
+    if (items.count() != m_itemCount) {
+        return false;
+    }
+
+    for (int i = 0; i < m_itemCount; i++) {
+        const QVariant &value = it->values[i];
+        if (value.isValid()) {
+            items[i]->setProperty(value);
+        }
+    }
+
+    return true;
+}
+
+//______________________________________________________________
+bool PresetsIndex::presetHasKwinBorderSizeKey(const QString &presetName) const
+{
+    auto it = m_presets.constFind(presetName);
+    return it != m_presets.constEnd() && it->hasKwinBorderSize;
+}
+
+//______________________________________________________________
+void PresetsIndex::copyKwinBorderSizeFromPresetToExceptionBorderSize(KCoreConfigSkeleton *skeleton, const QString &presetName) const
+{
+    auto it = m_presets.constFind(presetName);
+    if (it == m_presets.constEnd() || it->kwinBorderSize == -1) {
+        return;
+    }
+
+    const KConfigSkeletonItem::List items = skeleton->items();
+    if (items.count() != m_itemCount || m_borderSizeItemIndex < 0) {
+        return;
+    }
+
+    items[m_borderSizeItemIndex]->setProperty(it->kwinBorderSize);
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "breeze.h"
+#include "breezecommon_export.h"
+
+#include <QHash>
+#include <QVariant>
+#include <QVector>
+
+namespace Breeze
+{
+
+/**
+ * @brief In-memory index of the window decoration presets in a presets config.
+ *        Every preset is parsed once per presets config generation into a value vector aligned with the InternalSettings item order,
+ *        so that applying a preset is a flat copy rather than per-item KConfig reads
+ */
+class BREEZECOMMON_EXPORT PresetsIndex
+{
+public:
+    //* parses every preset in the given presets config
+    void rebuild(KConfig *presetsConfig);
+
+    //* drops the index. Call whenever the presets config has been reparsed
+    void invalidate();
+
+    //* true if the index has been built since the last invalidation
+    bool isValid() const
+    {
+        return m_valid;
+    }
+
+    bool isPresetPresent(const QString &presetName) const;
+
+    //* copies the preset values into the given InternalSettings. Returns false if there is no such preset
+    bool loadPreset(KCoreConfigSkeleton *skeleton, const QString &presetName) const;
+
+    bool presetHasKwinBorderSizeKey(const QString &presetName) const;
+
+    //* used in the case where you want to use the preset KwinBorderSize in an exception (window-specific override)
+    void copyKwinBorderSizeFromPresetToExceptionBorderSize(KCoreConfigSkeleton *skeleton, const QString &presetName) const;
+
+private:
+    struct Preset {
+        //* values in skeleton item order. Invalid for items which are not part of presets
+        QVector<QVariant> values;
+        bool hasKwinBorderSize = false;
+        //* BorderSize enum value matching KwinBorderSize, -1 if not a valid choice
+        int kwinBorderSize = -1;
+    };
+
+    bool m_valid = false;
+    int m_itemCount = 0;
+    int m_borderSizeItemIndex = -1;
+    QHash<QString, Preset> m_presets;
+};
+
+}
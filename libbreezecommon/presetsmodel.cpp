@@ -8,6 +8,10 @@
 #include <KConfigGroup>
 #include <QDir>
 #include <QRegularExpression>
+#include <QSet>
+#include <QThreadPool>
+
+#include <vector>
 
 namespace Breeze
 {
@@ -235,8 +239,7 @@ QStringList PresetsModel::readPresetsList(KConfig *presetsConfig)
 
 bool PresetsModel::isPresetPresent(KConfig *presetsConfig, const QString &presetName)
 {
-    QStringList list = readPresetsList(presetsConfig);
-    return list.contains(presetName);
+    return presetsConfig->hasGroup(presetGroupName(presetName));
 }
 
 bool PresetsModel::isPresetFromFilePresent(KConfig *presetsConfig, const QString &presetFileName, QString &presetName)
@@ -296,20 +299,27 @@ void PresetsModel::exportPreset(KConfig *presetsConfig, const QString &presetNam
 PresetsErrorFlag
 PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QString &presetName, QString &error, bool forceInvalidVersion, bool markAsBundled)
 {
-    KSharedConfig::Ptr importPresetConfig = KSharedConfig::openConfig(filePath);
+    PresetEntries entries;
+    PresetsErrorFlag readErrors = readPresetFile(filePath, presetName, entries, error, forceInvalidVersion);
+    if (readErrors != PresetsErrorFlag::None)
+        return readErrors;
 
-    if (!importPresetConfig)
-        return PresetsErrorFlag::InvalidGlobalGroup;
+    writePresetEntries(presetsConfig, presetName, entries, markAsBundled);
+    return PresetsErrorFlag::None;
+}
 
-    // perform validation first
-    if (!(importPresetConfig->hasGroup("Helium Window Decoration Preset File")) && !(importPresetConfig->hasGroup("Klassy Window Decoration Preset File")))
-        return PresetsErrorFlag::InvalidGlobalGroup;
+PresetsErrorFlag
+PresetsModel::readPresetFile(const QString &filePath, QString &presetName, PresetEntries &entries, QString &error, bool forceInvalidVersion)
+{
+    // a plain KConfig rather than a KSharedConfig, as this is also run from worker threads
+    KConfig importPresetConfig(filePath, KConfig::SimpleConfig);
 
+    // perform validation first
     KConfigGroup importGlobalGroup;
-    if (importPresetConfig->hasGroup("Helium Window Decoration Preset File")) {
-        importGlobalGroup = importPresetConfig->group("Helium Window Decoration Preset File");
-    } else if (importPresetConfig->hasGroup("Klassy Window Decoration Preset File")) {
-        importGlobalGroup = importPresetConfig->group("Klassy Window Decoration Preset File");
+    if (importPresetConfig.hasGroup("Helium Window Decoration Preset File")) {
+        importGlobalGroup = importPresetConfig.group("Helium Window Decoration Preset File");
+    } else if (importPresetConfig.hasGroup("Klassy Window Decoration Preset File")) {
+        importGlobalGroup = importPresetConfig.group("Klassy Window Decoration Preset File");
     } else {
         return PresetsErrorFlag::InvalidGlobalGroup;
     }
@@ -319,18 +329,17 @@ PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QStr
     if (!versionValid && !forceInvalidVersion)
         return PresetsErrorFlag::InvalidVersion;
 
-    QStringList presetsList = readPresetsList(importPresetConfig.data());
+    QStringList presetsList = readPresetsList(&importPresetConfig);
     if (presetsList.count())
         presetName = presetsList[0];
     else {
         return PresetsErrorFlag::InvalidGroup;
     }
 
-    QString importGroupName = presetGroupName(presetName);
-
-    KConfigGroup importGroup = importPresetConfig->group(importGroupName);
+    KConfigGroup importGroup = importPresetConfig.group(presetGroupName(presetName));
+    const QStringList importKeys = importGroup.keyList();
 
-    for (const QString &importKey : importGroup.keyList()) {
+    for (const QString &importKey : importKeys) {
         if (!isKeyValid(importKey)) {
             error = importKey;
             return PresetsErrorFlag::InvalidKey;
@@ -339,40 +348,56 @@ PresetsModel::importPreset(KConfig *presetsConfig, const QString &filePath, QStr
 
     // end of validation
 
+    entries.clear();
+    entries.reserve(importKeys.count());
+    for (const QString &importKey : importKeys) {
+        entries.append(qMakePair(importKey, importGroup.readEntry(importKey)));
+    }
+
+    return PresetsErrorFlag::None;
+}
+
+void PresetsModel::writePresetEntries(KConfig *presetsConfig, const QString &presetName, const PresetEntries &entries, bool markAsBundled)
+{
+    QString groupName = presetGroupName(presetName);
+
     // delete an existing preset if has the same name
-    if (isPresetPresent(presetsConfig, presetName)) {
-        deletePreset(presetsConfig, presetName);
+    if (presetsConfig->hasGroup(groupName)) {
+        presetsConfig->deleteGroup(groupName);
     }
 
-    // start writing the values
-    auto internalSettings = InternalSettingsPtr(new InternalSettings());
-    KConfigGroup configGroup(presetsConfig, importGroupName);
+    KConfigGroup configGroup(presetsConfig, groupName);
 
-    for (const QString &importKey : importGroup.keyList()) {
-        QString importProperty = importGroup.readEntry(importKey);
-        configGroup.writeEntry(importKey, importProperty);
+    for (const auto &entry : entries) {
+        configGroup.writeEntry(entry.first, entry.second);
     }
 
     if (markAsBundled)
         configGroup.writeEntry("BundledPreset", "true");
-
-    return PresetsErrorFlag::None;
 }
 
-bool PresetsModel::isKeyValid(const QString &key)
+const QSet<QString> &PresetsModel::validKeys()
 {
-    auto internalSettings = InternalSettingsPtr(new InternalSettings());
-
-    for (const auto &item : internalSettings->items()) {
-        if (item->key() == key) {
-            return true;
+    static const QSet<QString> keys = []() {
+        QSet<QString> keys;
+        auto internalSettings = InternalSettingsPtr(new InternalSettings());
+        for (const auto &item : internalSettings->items()) {
+            keys.insert(item->key());
         }
-    }
 
-    if (key == "KwinBorderSize" || key == "KwinButtonsOnLeft" || key == "KwinButtonsOnRight")
-        return true; // additional valid key containing KWin border size setting from kwinrc
+        // additional valid keys containing KWin border size and button settings from kwinrc
+        keys.insert(QStringLiteral("KwinBorderSize"));
+        keys.insert(QStringLiteral("KwinButtonsOnLeft"));
+        keys.insert(QStringLiteral("KwinButtonsOnRight"));
+        return keys;
+    }();
 
-    return false;
+    return keys;
+}
+
+bool PresetsModel::isKeyValid(const QString &key)
+{
+    return validKeys().contains(key);
 }
 
 // copies bundled presets in /usr/lib64/qt6/plugins/org.kde.kdecoration3.kcm/heliumdecoration/presets into ~/.config/helium/heliumrc once per release
@@ -394,6 +419,7 @@ void PresetsModel::importBundledPresets(KConfig *presetsConfig)
     // if the user modified the preset it will not contain the BundledPreset flag and hence won't be deleted
     PresetsModel::deleteBundledPresets(presetsConfig);
 
+    QStringList presetFiles;
     for (QString libraryPath : QCoreApplication::libraryPaths()) {
         libraryPath += "/org.kde.kdecoration3.kcm/heliumdecoration/presets";
         QDir presetsDir(libraryPath);
@@ -401,21 +427,41 @@ void PresetsModel::importBundledPresets(KConfig *presetsConfig)
             QStringList filters;
             filters << "*.helium-deco";
             presetsDir.setNameFilters(filters);
-            QStringList presetFiles = presetsDir.entryList();
-
-            for (QString presetFile : presetFiles) {
-                presetFile = libraryPath + "/" + presetFile; // set absolute full path
-                QString presetName;
-                QString error;
 
-                PresetsErrorFlag importErrors = PresetsModel::importPreset(presetsConfig, presetFile, presetName, error, false, true);
-                if (importErrors != PresetsErrorFlag::None) {
-                    continue;
-                }
+            for (const QString &presetFile : presetsDir.entryList()) {
+                presetFiles.append(libraryPath + "/" + presetFile); // set absolute full path
             }
         }
     }
 
+    // build the set of valid keys on this thread, as InternalSettings opens a KSharedConfig, which must not be done from the worker threads
+    validKeys();
+
+    // read and validate the preset files concurrently
+    struct BundledPreset {
+        QString name;
+        PresetEntries entries;
+        PresetsErrorFlag errors = PresetsErrorFlag::None;
+    };
+    std::vector<BundledPreset> bundledPresets(presetFiles.count());
+
+    QThreadPool threadPool;
+    for (int i = 0; i < presetFiles.count(); i++) {
+        threadPool.start([&presetFile = presetFiles.at(i), &bundledPreset = bundledPresets[i]]() {
+            QString error;
+            bundledPreset.errors = PresetsModel::readPresetFile(presetFile, bundledPreset.name, bundledPreset.entries, error);
+        });
+    }
+    threadPool.waitForDone();
+
+    // write in directory order, so that a later preset of the same name still replaces an earlier one
+    for (const BundledPreset &bundledPreset : bundledPresets) {
+        if (bundledPreset.errors != PresetsErrorFlag::None) {
+            continue;
+        }
+        writePresetEntries(presetsConfig, bundledPreset.name, bundledPreset.entries, true);
+    }
+
     KConfigGroup globalGroup = presetsConfig->group("Global");
     globalGroup.writeEntry("BundledWindecoPresetsImportedVersion", heliumLongVersion());
     presetsConfig->sync();
@@ -9,6 +9,9 @@
 #include "breeze.h"
 #include "breezecommon_export.h"
 
+#include <QPair>
+#include <QSet>
+
 namespace Breeze
 {
 
@@ -58,7 +61,23 @@ public:
                                          bool markAsBundled = false);
     static bool isKeyValid(const QString &key);
     static bool isEnumValueValid(const QString &key, const QString &property);
+
+    //* imports bundled presets once per release. Preset files are read and validated concurrently, then written with a single sync
     static void importBundledPresets(KConfig *presetsConfig);
+
+private:
+    //* key/value pairs of a preset group, as read from a preset file
+    using PresetEntries = QList<QPair<QString, QString>>;
+
+    //* reads and validates a preset file without touching the presets config. Safe to call from worker threads
+    static PresetsErrorFlag
+    readPresetFile(const QString &filePath, QString &presetName, PresetEntries &entries, QString &error, bool forceInvalidVersion = false);
+
+    //* replaces the preset of the given name in the presets config with the given entries
+    static void writePresetEntries(KConfig *presetsConfig, const QString &presetName, const PresetEntries &entries, bool markAsBundled);
+
+    //* keys accepted in preset files
+    static const QSet<QString> &validKeys();
 };
 
 }
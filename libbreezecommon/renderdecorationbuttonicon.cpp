@@ -5,6 +5,7 @@
  */
 
 #include "renderdecorationbuttonicon.h"
+#include "buttonicongeometryplan.h"
 #include "stylefluent.h"
 #include "stylekisweet.h"
 #include "stylekite.h"
@@ -27,41 +28,46 @@ std::pair<std::unique_ptr<RenderDecorationButtonIcon>, int> RenderDecorationButt
                                                                                                 const QPointF &deviceOffsetFromZeroReference,
                                                                                                 const bool forceEvenSquares)
 {
+    std::unique_ptr<RenderDecorationButtonIcon> renderer;
+
     switch (internalSettings->buttonIconStyle()) {
     case InternalSettings::EnumButtonIconStyle::StyleKisweet:
     default:
-        return {
-            std::make_unique<RenderStyleKisweet18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleKisweet18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleKlasse:
-        return {
-            std::make_unique<RenderStyleKlasse18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleKlasse18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleKite:
-        return {
-            std::make_unique<RenderStyleKite18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleKite18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleOxygen:
-        return {
-            std::make_unique<RenderStyleOxygen18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleOxygen18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleTraditional:
-        return {std::make_unique<RenderStyleTraditional18By18>(painter,
-                                                               fromKstyle,
-                                                               boldButtonIcons,
-                                                               devicePixelRatio,
-                                                               deviceOffsetFromZeroReference,
-                                                               forceEvenSquares),
-                18};
+        renderer = std::make_unique<RenderStyleTraditional18By18>(painter,
+                                                                  fromKstyle,
+                                                                  boldButtonIcons,
+                                                                  devicePixelRatio,
+                                                                  deviceOffsetFromZeroReference,
+                                                                  forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleMetro:
-        return {
-            std::make_unique<RenderStyleMetro18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleMetro18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     case InternalSettings::EnumButtonIconStyle::StyleFluent:
-        return {
-            std::make_unique<RenderStyleFluent18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares),
-            18};
+        renderer =
+            std::make_unique<RenderStyleFluent18By18>(painter, fromKstyle, boldButtonIcons, devicePixelRatio, deviceOffsetFromZeroReference, forceEvenSquares);
+        break;
     }
+
+    renderer->m_iconStyle = internalSettings->buttonIconStyle();
+    return {std::move(renderer), 18};
 }
 
 RenderDecorationButtonIcon::RenderDecorationButtonIcon(QPainter *painter,
@@ -96,6 +102,59 @@ void RenderDecorationButtonIcon::initPainter()
 }
 
 void RenderDecorationButtonIcon::renderIcon(DecorationButtonType type, bool checked)
+{
+    const QPen pen(m_painter->pen());
+    const QTransform deviceTransform(m_painter->deviceTransform());
+
+    ButtonIconGeometryPlanKey key;
+    key.iconStyle = m_iconStyle;
+    key.buttonType = static_cast<int>(type);
+    key.checked = checked;
+    key.fromKstyle = m_fromKstyle;
+    key.boldButtonIcons = m_boldButtonIcons;
+    key.forceEvenSquares = m_forceEvenSquares;
+    key.strokeToFilledPath = m_strokeToFilledPath;
+    key.cosmeticPen = pen.isCosmetic();
+    key.penStyle = static_cast<int>(pen.style());
+    key.penAlpha = pen.color().alpha();
+    key.renderHints = static_cast<int>(m_painter->renderHints());
+    key.penWidth = pen.widthF();
+    key.devicePixelRatio = m_devicePixelRatio;
+    key.deviceOffsetFromZeroReference = m_deviceOffsetFromZeroReference;
+    key.m11 = deviceTransform.m11();
+    key.m12 = deviceTransform.m12();
+    key.m21 = deviceTransform.m21();
+    key.m22 = deviceTransform.m22();
+
+    const ButtonIconGeometryPlan *plan(ButtonIconGeometryPlanCache::find(key));
+
+    if (!plan) {
+        // compile the icon by rendering it against a recording device, with the same pen and scaling as the real painter
+        ButtonIconGeometryPlanRecorder recorder(deviceTransform);
+        QPainter recordingPainter(&recorder);
+        recordingPainter.setWorldTransform(deviceTransform);
+        recordingPainter.setRenderHints(m_painter->renderHints());
+        recordingPainter.setPen(pen);
+        recordingPainter.setBrush(m_painter->brush());
+
+        QPainter *painter(m_painter);
+        m_painter = &recordingPainter;
+        renderIconPrimitives(type, checked);
+        m_painter = painter;
+        recordingPainter.end();
+
+        if (!recorder.isValid()) {
+            renderIconPrimitives(type, checked);
+            return;
+        }
+
+        plan = ButtonIconGeometryPlanCache::insert(key, recorder.takePlan());
+    }
+
+    plan->replay(m_painter);
+}
+
+void RenderDecorationButtonIcon::renderIconPrimitives(DecorationButtonType type, bool checked)
 {
     m_painter->save();
     initPainter();
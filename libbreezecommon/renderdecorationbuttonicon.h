@@ -74,6 +74,10 @@ public:
     {
         m_strokeToFilledPath = v;
     }
+    /**
+     * @brief Renders the icon for the given button type. Icons are compiled once into a ButtonIconGeometryPlan per geometry tuple, and
+     *        replayed from the plan on subsequent renders
+     */
     void renderIcon(DecorationButtonType type, bool checked);
 
 protected:
@@ -97,6 +101,11 @@ protected:
                                const QPointF &deviceOffsetFromZeroReference,
                                const bool forceEvenSquares);
 
+    /**
+     * @brief Renders the icon primitives directly onto m_painter, without going through a geometry plan
+     */
+    void renderIconPrimitives(DecorationButtonType type, bool checked);
+
     /**
      * @brief Initialises pen to standardise cap and join styles.
      * No brush is normal for Breeze's simple outline style.
@@ -218,6 +227,7 @@ protected:
     qreal straightLineOpacity();
 
     QPainter *m_painter;
+    int m_iconStyle = -1; // EnumButtonIconStyle this renderer was created for, used to key geometry plans
     bool m_isOddPenWidth = true;
     bool m_fromKstyle;
     bool m_boldButtonIcons;
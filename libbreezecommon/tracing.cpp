@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#include "tracing.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+
+#include <chrono>
+
+namespace Breeze
+{
+
+namespace
+{
+
+//* number of buffered events above which they are written to the file
+constexpr int flushThreshold = 4096;
+
+//* closes the event array and the top level object. Rewritten after every flush so that the file is always valid JSON
+constexpr char footer[] = "\n]}\n";
+
+struct TraceEvent {
+    const char *category;
+    const char *name;
+    qint64 start;
+    qint64 duration;
+    quintptr threadId;
+};
+
+class TraceWriter
+{
+public:
+    TraceWriter()
+    {
+        QString path = qEnvironmentVariable("HELIUM_TRACE_FILE");
+        if (path.isEmpty()) {
+            return;
+        }
+
+        _processId = QCoreApplication::applicationPid();
+        path.replace(QStringLiteral("%p"), QString::number(_processId));
+
+        _file.setFileName(path);
+        if (!_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            return;
+        }
+
+        _file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        _footerPosition = _file.pos();
+        _file.write(footer);
+        _file.flush();
+
+        _events.reserve(flushThreshold);
+        _enabled = true;
+    }
+
+    ~TraceWriter()
+    {
+        flush();
+    }
+
+    bool enabled() const
+    {
+        return _enabled;
+    }
+
+    void record(const TraceEvent &event)
+    {
+        QMutexLocker locker(&_mutex);
+        _events.append(event);
+        if (_events.size() >= flushThreshold) {
+            flushLocked();
+        }
+    }
+
+    void flush()
+    {
+        QMutexLocker locker(&_mutex);
+        flushLocked();
+    }
+
+private:
+    void flushLocked()
+    {
+        if (_events.isEmpty()) {
+            return;
+        }
+
+        QByteArray data;
+        data.reserve(_events.size() * 128);
+        for (const TraceEvent &event : std::as_const(_events)) {
+            data.append(_eventCount++ ? ",\n" : "\n");
+            data.append("{\"cat\":\"");
+            data.append(event.category);
+            data.append("\",\"name\":\"");
+            data.append(event.name);
+            data.append("\",\"ph\":\"X\",\"ts\":");
+            data.append(QByteArray::number(event.start / 1000.0, 'f', 3));
+            data.append(",\"dur\":");
+            data.append(QByteArray::number(event.duration / 1000.0, 'f', 3));
+            data.append(",\"pid\":");
+            data.append(QByteArray::number(_processId));
+            data.append(",\"tid\":");
+            data.append(QByteArray::number(quint64(event.threadId)));
+            data.append('}');
+        }
+        _events.clear();
+
+        _file.seek(_footerPosition);
+        _file.write(data);
+        _footerPosition = _file.pos();
+        _file.write(footer);
+        _file.flush();
+    }
+
+    QMutex _mutex;
+    QFile _file;
+    QVector<TraceEvent> _events;
+    qint64 _processId = 0;
+    qint64 _footerPosition = 0;
+    qint64 _eventCount = 0;
+    bool _enabled = false;
+};
+
+TraceWriter &writer()
+{
+    static TraceWriter writer;
+    return writer;
+}
+
+}
+
+namespace Tracer
+{
+
+//____________________________________________________________________
+bool enabled()
+{
+    return writer().enabled();
+}
+
+//____________________________________________________________________
+qint64 now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//____________________________________________________________________
+void record(const char *category, const char *name, qint64 start, qint64 duration)
+{
+    writer().record({category, name, start, duration, reinterpret_cast<quintptr>(QThread::currentThreadId())});
+}
+
+//____________________________________________________________________
+void flush()
+{
+    writer().flush();
+}
+
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Helium contributors
+ *
+ * SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+ */
+
+#pragma once
+
+#include "breezecommon_export.h"
+
+#include <QtGlobal>
+
+/**
+ * Scoped timers for the decoration and style hot paths.
+ *
+ * Tracing is compiled in only when configuring with -DHELIUM_TRACING=ON. Otherwise HELIUM_TRACE_SCOPE expands to nothing.
+ * When compiled in, events are recorded only if HELIUM_TRACE_FILE is set in the environment, and written to that file
+ * as Chrome trace-event JSON, that can be loaded in chrome://tracing or https://ui.perfetto.dev.
+ * A "%p" in the file name is replaced with the process id, so that each process using the style writes its own trace.
+ *
+ * Category and name must be string literals that need no JSON escaping.
+ */
+#ifdef HELIUM_TRACING
+#define HELIUM_TRACE_CONCAT_IMPL(a, b) a##b
+#define HELIUM_TRACE_CONCAT(a, b) HELIUM_TRACE_CONCAT_IMPL(a, b)
+#define HELIUM_TRACE_SCOPE(category, name) const Breeze::TraceScope HELIUM_TRACE_CONCAT(heliumTraceScope, __LINE__)(category, name)
+#else
+#define HELIUM_TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
+
+#ifdef HELIUM_TRACING
+
+namespace Breeze
+{
+
+namespace Tracer
+{
+//* true if a trace file was requested, and could be opened
+BREEZECOMMON_EXPORT bool enabled();
+
+//* monotonic time, in nanoseconds
+BREEZECOMMON_EXPORT qint64 now();
+
+//* record a complete event
+BREEZECOMMON_EXPORT void record(const char *category, const char *name, qint64 start, qint64 duration);
+
+//* write pending events to the trace file
+BREEZECOMMON_EXPORT void flush();
+}
+
+//* records the time spent between its construction and destruction
+class TraceScope
+{
+public:
+    //* constructor
+    TraceScope(const char *category, const char *name)
+        : _category(category)
+        , _name(name)
+        , _start(Tracer::enabled() ? Tracer::now() : -1)
+    {
+    }
+
+    //* destructor
+    ~TraceScope()
+    {
+        if (_start >= 0) {
+            Tracer::record(_category, _name, _start, Tracer::now() - _start);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(TraceScope)
+
+    const char *_category;
+    const char *_name;
+
+    //* start time, or -1 if tracing is disabled
+    qint64 _start;
+};
+
+}
+
+#endif